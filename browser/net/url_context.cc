@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "brave/common/extensions/extension_constants.h"
 #include "brave/common/pref_names.h"
@@ -53,37 +54,36 @@ bool IsWebTorrentDisabled(content::ResourceContext* resource_context) {
 #endif  // BUILDFLAG(ENABLE_BRAVE_WEBTORRENT)
 }
 
-std::string GetUploadDataFromURLRequest(const net::URLRequest* request) {
-  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
-  if (!request->has_upload())
-    return {};
+}  // namespace
+
+BraveRequestInfo::BraveRequestInfo() = default;
 
-  const net::UploadDataStream* stream = request->get_upload();
-  if (!stream->GetElementReaders())
-    return {};
+BraveRequestInfo::~BraveRequestInfo() = default;
+
+bool BraveRequestInfo::GetUploadData(
+    std::vector<base::StringPiece>* chunks) const {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  DCHECK(chunks);
+  if (!upload_data)
+    return false;
 
-  const auto* element_readers = stream->GetElementReaders();
-  if (element_readers->empty())
-    return {};
+  const auto* element_readers = upload_data->GetElementReaders();
+  if (!element_readers || element_readers->empty())
+    return false;
 
-  std::string upload_data;
+  const size_t first_chunk = chunks->size();
   for (const auto& element_reader : *element_readers) {
     const net::UploadBytesElementReader* reader =
         element_reader->AsBytesReader();
     if (!reader) {
-      return {};
+      chunks->resize(first_chunk);
+      return false;
     }
-    upload_data.append(reader->bytes(), reader->length());
+    chunks->emplace_back(reader->bytes(), reader->length());
   }
-  return upload_data;
+  return true;
 }
 
-}  // namespace
-
-BraveRequestInfo::BraveRequestInfo() = default;
-
-BraveRequestInfo::~BraveRequestInfo() = default;
-
 void BraveRequestInfo::FillCTXFromRequest(const net::URLRequest* request,
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   ctx->request_identifier = request->identifier();
@@ -136,7 +136,7 @@ void BraveRequestInfo::FillCTXFromRequest(const net::URLRequest* request,
       request, ctx->tab_origin, ctx->tab_origin, CONTENT_SETTINGS_TYPE_PLUGINS,
       brave_shields::kReferrers);
 
-  ctx->upload_data = GetUploadDataFromURLRequest(request);
+  ctx->upload_data = request->get_upload();
 }
 
 }  // namespace brave
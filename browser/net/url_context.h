@@ -8,7 +8,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/strings/string_piece.h"
 #include "chrome/browser/net/chrome_network_delegate.h"
 #include "content/public/common/resource_type.h"
 #include "net/url_request/url_request.h"
@@ -16,6 +18,10 @@
 
 class BraveNetworkDelegateBase;
 
+namespace net {
+class UploadDataStream;
+}  // namespace net
+
 namespace brave {
 
 struct BraveRequestInfo;
@@ -84,7 +90,14 @@ struct BraveRequestInfo {
       static_cast<content::ResourceType>(-1);
   content::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // The request body, owned by the request. It isn't copied, read it with
+  // GetUploadData once it's known to be needed
+  const net::UploadDataStream* upload_data = nullptr;
+
+  // Adds the chunks of the request body to |chunks|, pointing into the
+  // request. Returns false if there's no body or if part of it isn't held in
+  // memory, such as a file being uploaded
+  bool GetUploadData(std::vector<base::StringPiece>* chunks) const;
 
   static void FillCTXFromRequest(const net::URLRequest* request,
                                  std::shared_ptr<brave::BraveRequestInfo> ctx);
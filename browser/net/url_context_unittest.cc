@@ -0,0 +1,109 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_context.h"
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
+#include "content/public/test/test_browser_thread_bundle.h"
+#include "net/base/elements_upload_data_stream.h"
+#include "net/base/upload_bytes_element_reader.h"
+#include "net/base/upload_file_element_reader.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "net/url_request/url_request_test_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+class BraveRequestInfoTest : public testing::Test {
+ public:
+  BraveRequestInfoTest()
+      : thread_bundle_(content::TestBrowserThreadBundle::IO_MAINLOOP),
+        context_(new net::TestURLRequestContext(true)) {}
+  ~BraveRequestInfoTest() override {}
+  void SetUp() override { context_->Init(); }
+
+  std::unique_ptr<net::URLRequest> CreateRequest() {
+    return context_->CreateRequest(GURL("https://brave.com/upload"),
+                                   net::IDLE,
+                                   &test_delegate_,
+                                   TRAFFIC_ANNOTATION_FOR_TESTS);
+  }
+
+ private:
+  content::TestBrowserThreadBundle thread_bundle_;
+  std::unique_ptr<net::TestURLRequestContext> context_;
+  net::TestDelegate test_delegate_;
+};
+
+TEST_F(BraveRequestInfoTest, NoUploadData) {
+  std::unique_ptr<net::URLRequest> request = CreateRequest();
+  auto ctx = std::make_shared<brave::BraveRequestInfo>();
+  brave::BraveRequestInfo::FillCTXFromRequest(request.get(), ctx);
+
+  std::vector<base::StringPiece> chunks;
+  EXPECT_FALSE(ctx->upload_data);
+  EXPECT_FALSE(ctx->GetUploadData(&chunks));
+  EXPECT_TRUE(chunks.empty());
+}
+
+TEST_F(BraveRequestInfoTest, BytesUploadData) {
+  const std::string first = "data=";
+  const std::string second = "eyJldmVudCI6Im1pbnV0ZS13YXRjaGVkIn0=";
+
+  std::vector<std::unique_ptr<net::UploadElementReader>> readers;
+  readers.push_back(std::make_unique<net::UploadBytesElementReader>(
+      first.data(), first.size()));
+  readers.push_back(std::make_unique<net::UploadBytesElementReader>(
+      second.data(), second.size()));
+
+  std::unique_ptr<net::URLRequest> request = CreateRequest();
+  request->set_upload(std::make_unique<net::ElementsUploadDataStream>(
+      std::move(readers), 0));
+  auto ctx = std::make_shared<brave::BraveRequestInfo>();
+  brave::BraveRequestInfo::FillCTXFromRequest(request.get(), ctx);
+
+  std::vector<base::StringPiece> chunks;
+  ASSERT_TRUE(ctx->GetUploadData(&chunks));
+  ASSERT_EQ(chunks.size(), 2u);
+  EXPECT_EQ(chunks[0], first);
+  EXPECT_EQ(chunks[1], second);
+  // The chunks aren't copied
+  EXPECT_EQ(chunks[0].data(), first.data());
+}
+
+TEST_F(BraveRequestInfoTest, FileUploadData) {
+  const std::string bytes = "data=";
+
+  std::vector<std::unique_ptr<net::UploadElementReader>> readers;
+  readers.push_back(std::make_unique<net::UploadBytesElementReader>(
+      bytes.data(), bytes.size()));
+  readers.push_back(std::make_unique<net::UploadFileElementReader>(
+      base::ThreadTaskRunnerHandle::Get().get(),
+      base::FilePath(FILE_PATH_LITERAL("upload.bin")),
+      0,
+      std::numeric_limits<uint64_t>::max(),
+      base::Time()));
+
+  std::unique_ptr<net::URLRequest> request = CreateRequest();
+  request->set_upload(std::make_unique<net::ElementsUploadDataStream>(
+      std::move(readers), 0));
+  auto ctx = std::make_shared<brave::BraveRequestInfo>();
+  brave::BraveRequestInfo::FillCTXFromRequest(request.get(), ctx);
+
+  std::vector<base::StringPiece> chunks;
+  EXPECT_FALSE(ctx->GetUploadData(&chunks));
+  EXPECT_TRUE(chunks.empty());
+}
+
+}  // namespace
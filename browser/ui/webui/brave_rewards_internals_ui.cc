@@ -5,10 +5,12 @@
 
 #include "brave/browser/ui/webui/brave_rewards_internals_ui.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "brave/components/brave_rewards/browser/rewards_internals_info.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
 #include "brave/components/brave_rewards/common/pref_names.h"
@@ -29,6 +31,21 @@
 
 namespace {
 
+std::unique_ptr<base::ListValue> LatencyInfosToList(
+    const std::map<std::string, brave_rewards::LatencyInfo>& infos) {
+  auto list = std::make_unique<base::ListValue>();
+  for (const auto& item : infos) {
+    auto latency_info = std::make_unique<base::DictionaryValue>();
+    latency_info->SetString("name", item.first);
+    latency_info->SetInteger("count", item.second.count);
+    latency_info->SetDouble("average", item.second.average_ms);
+    latency_info->SetDouble("max", item.second.max_ms);
+    list->Append(std::move(latency_info));
+  }
+
+  return list;
+}
+
 class RewardsInternalsDOMHandler : public content::WebUIMessageHandler {
  public:
   RewardsInternalsDOMHandler();
@@ -136,6 +153,23 @@ void RewardsInternalsDOMHandler::OnGetRewardsInternalsInfo(
     info_dict.SetString("personaId", info->persona_id);
     info_dict.SetString("userId", info->user_id);
     info_dict.SetInteger("bootStamp", info->boot_stamp);
+    info_dict.SetList("ledgerCalls", LatencyInfosToList(info->ledger_calls));
+    info_dict.SetList("databaseQueries",
+                      LatencyInfosToList(info->database_queries));
+    auto state_writes = std::make_unique<base::ListValue>();
+    for (const auto& item : info->state_writes) {
+      auto write_info = std::make_unique<base::DictionaryValue>();
+      write_info->SetString("name", item.first);
+      write_info->SetInteger("count", item.second.count);
+      write_info->SetDouble("totalBytes", item.second.total_bytes);
+      write_info->SetDouble("lastBytes", item.second.last_bytes);
+      write_info->SetDouble("writesPerHour", item.second.writes_per_hour);
+      state_writes->Append(std::move(write_info));
+    }
+    info_dict.SetList("stateWrites", std::move(state_writes));
+    info_dict.SetDouble("publisherListCount", info->publisher_list_count);
+    info_dict.SetDouble("publisherListBytes", info->publisher_list_bytes);
+    info_dict.SetInteger("pendingTimers", info->pending_timers);
   }
   web_ui()->CallJavascriptFunctionUnsafe(
       "brave_rewards_internals.onGetRewardsInternalsInfo", info_dict);
@@ -635,11 +635,23 @@ void CustomizeWebUIHTMLSource(const std::string &name,
     }, {
       std::string("rewards-internals"), {
         { "amount", IDS_BRAVE_REWARDS_INTERNALS_AMOUNT },
+        { "averageMs", IDS_BRAVE_REWARDS_INTERNALS_AVERAGE_MS },
         { "bootStamp", IDS_BRAVE_REWARDS_INTERNALS_BOOT_STAMP },
+        { "count", IDS_BRAVE_REWARDS_INTERNALS_COUNT },
         { "currentReconcile", IDS_BRAVE_REWARDS_INTERNALS_CURRENT_RECONCILE },
+        { "databaseQueries", IDS_BRAVE_REWARDS_INTERNALS_DATABASE_QUERIES },
         { "invalid", IDS_BRAVE_REWARDS_INTERNALS_INVALID },
         { "keyInfoSeed", IDS_BRAVE_REWARDS_INTERNALS_KEY_INFO_SEED },
+        { "lastBytes", IDS_BRAVE_REWARDS_INTERNALS_LAST_BYTES },
+        { "ledgerCalls", IDS_BRAVE_REWARDS_INTERNALS_LEDGER_CALLS },
+        { "maxMs", IDS_BRAVE_REWARDS_INTERNALS_MAX_MS },
+        { "name", IDS_BRAVE_REWARDS_INTERNALS_NAME },
+        { "pendingTimers", IDS_BRAVE_REWARDS_INTERNALS_PENDING_TIMERS },
         { "personaId", IDS_BRAVE_REWARDS_INTERNALS_PERSONA_ID },
+        { "publisherListBytes",
+          IDS_BRAVE_REWARDS_INTERNALS_PUBLISHER_LIST_BYTES },
+        { "publisherListCount",
+          IDS_BRAVE_REWARDS_INTERNALS_PUBLISHER_LIST_COUNT },
         { "refreshButton", IDS_BRAVE_REWARDS_INTERNALS_REFRESH_BUTTON },
         { "retryLevel", IDS_BRAVE_REWARDS_INTERNALS_RETRY_LEVEL },
         { "retryStep", IDS_BRAVE_REWARDS_INTERNALS_RETRY_STEP },
@@ -655,10 +667,13 @@ void CustomizeWebUIHTMLSource(const std::string &name,
         { "retryStepVote", IDS_BRAVE_REWARDS_INTERNALS_RETRY_STEP_VOTE },
         { "retryStepWinners", IDS_BRAVE_REWARDS_INTERNALS_RETRY_STEP_WINNERS },
         { "rewardsNotEnabled", IDS_BRAVE_REWARDS_INTERNALS_REWARDS_NOT_ENABLED },                // NOLINT
+        { "stateWrites", IDS_BRAVE_REWARDS_INTERNALS_STATE_WRITES },
+        { "totalBytes", IDS_BRAVE_REWARDS_INTERNALS_TOTAL_BYTES },
         { "userId", IDS_BRAVE_REWARDS_INTERNALS_USER_ID },
         { "valid", IDS_BRAVE_REWARDS_INTERNALS_VALID },
         { "viewingId", IDS_BRAVE_REWARDS_INTERNALS_VIEWING_ID },
         { "walletPaymentId", IDS_BRAVE_REWARDS_INTERNALS_WALLET_PAYMENT_ID },
+        { "writesPerHour", IDS_BRAVE_REWARDS_INTERNALS_WRITES_PER_HOUR },
       }
     }
   };
@@ -17,6 +17,7 @@
 namespace brave_ads {
 
 using IsSupportedRegionCallback = base::OnceCallback<void(bool)>;
+using ShouldClassifyPageCallback = base::OnceCallback<void(bool)>;
 
 class AdsService : public KeyedService {
  public:
@@ -33,6 +34,9 @@ class AdsService : public KeyedService {
   // ads::Ads proxy
   virtual void SetConfirmationsIsReady(const bool is_ready) = 0;
   virtual void ChangeLocale(const std::string& locale) = 0;
+  virtual void ShouldClassifyPage(
+      const std::string& url,
+      ShouldClassifyPageCallback callback) = 0;
   virtual void ClassifyPage(
       const std::string& url,
       const std::string& page) = 0;
@@ -54,7 +54,6 @@
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "services/service_manager/public/cpp/connector.h"
-#include "third_party/dom_distiller_js/dom_distiller.pb.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/message_center/public/cpp/notification.h"
@@ -1200,6 +1199,17 @@ void AdsServiceImpl::ChangeLocale(const std::string& locale) {
   bat_ads_->ChangeLocale(locale);
 }
 
+void AdsServiceImpl::ShouldClassifyPage(
+    const std::string& url,
+    ShouldClassifyPageCallback callback) {
+  if (!connected()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  bat_ads_->ShouldClassifyPage(url, std::move(callback));
+}
+
 void AdsServiceImpl::ClassifyPage(const std::string& url,
                                   const std::string& page) {
   if (!connected())
@@ -1484,14 +1494,12 @@ void AdsServiceImpl::ViewAd(const std::string& id) {
       id, base::BindOnce(&AdsServiceImpl::OnViewAd, AsWeakPtr()));
 }
 
-void AdsServiceImpl::OnViewAd(const std::string& json) {
-  ads::NotificationInfo notification;
-  notification.FromJson(json);
-
-  bat_ads_->OnNotificationEvent(notification.id,
+void AdsServiceImpl::OnViewAd(
+    bat_ads::mojom::NotificationInfoPtr notification) {
+  bat_ads_->OnNotificationEvent(notification->id,
       ToMojomNotificationEventType(ads::NotificationEventType::CLICKED));
 
-  OpenNewTabWithUrl(notification.url);
+  OpenNewTabWithUrl(notification->url);
 }
 
 void AdsServiceImpl::OpenNewTabWithUrl(const std::string& url) {
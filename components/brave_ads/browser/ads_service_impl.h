@@ -72,6 +72,9 @@ class AdsServiceImpl : public AdsService,
 
   void SetConfirmationsIsReady(const bool is_ready) override;
   void ChangeLocale(const std::string& locale) override;
+  void ShouldClassifyPage(
+      const std::string& url,
+      ShouldClassifyPageCallback callback) override;
   void ClassifyPage(const std::string& url, const std::string& page) override;
   void OnMediaStart(SessionID tab_id) override;
   void OnMediaStop(SessionID tab_id) override;
@@ -112,7 +115,7 @@ class AdsServiceImpl : public AdsService,
       bool by_user,
       base::OnceClosure completed_closure);
   void ViewAd(const std::string& id);
-  void OnViewAd(const std::string& json);
+  void OnViewAd(bat_ads::mojom::NotificationInfoPtr notification);
   void OpenNewTabWithUrl(const std::string& url);
 
   // AdsClient implementation
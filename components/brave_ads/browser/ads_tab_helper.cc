@@ -5,22 +5,21 @@
 
 #include "brave/components/brave_ads/browser/ads_tab_helper.h"
 
-#include <memory>
+#include <string>
 #include <utility>
 
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/values.h"
+#include "brave/common/brave_isolated_worlds.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
-#include "chrome/browser/dom_distiller/dom_distiller_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/sessions/session_tab_helper.h"
-#include "components/dom_distiller/content/browser/distiller_page_web_contents.h"
-#include "components/dom_distiller/content/browser/web_contents_main_frame_observer.h"
-#include "components/dom_distiller/core/distiller_page.h"
-#include "components/dom_distiller/core/dom_distiller_service.h"
 #include "content/public/browser/navigation_handle.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/web_contents.h"
-#include "ui/base/resource/resource_bundle.h"
 
 #if !defined(OS_ANDROID)
 #include "chrome/browser/ui/browser.h"
@@ -30,13 +29,32 @@
 
 namespace brave_ads {
 
+namespace {
+
+// The visible text of a page is capped so that the cost of extracting,
+// transferring and classifying it is bounded regardless of the page size
+const size_t kMaximumPageTextLength = 64 * 1024;
+
+// Returns the visible text of the page with whitespace collapsed. The raw text
+// is truncated before normalizing so heavy pages are not processed in full
+const char kExtractPageTextScript[] =
+    "(function() {"
+    "  if (!document.body) {"
+    "    return '';"
+    "  }"
+    "  return document.body.innerText.substring(0, %zu)"
+    "      .replace(/\\s+/g, ' ').trim().substring(0, %zu);"
+    "})()";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(SessionTabHelper::IdForTab(web_contents)),
       ads_service_(nullptr),
       is_active_(false),
       is_browser_active_(true),
-      run_distiller_(false),
+      should_classify_page_(false),
       weak_factory_(this) {
   if (!tab_id_.is_valid())
     return;
@@ -64,67 +82,66 @@ void AdsTabHelper::DidFinishNavigation(
       navigation_handle->GetResponseHeaders()) {
     if (navigation_handle->GetResponseHeaders()->HasHeaderValue(
             "cache-control", "no-store")) {
-      run_distiller_ = false;
+      should_classify_page_ = false;
     } else {
       bool was_restored =
           navigation_handle->GetRestoreType() != content::RestoreType::NONE;
-      run_distiller_ = !was_restored;
+      should_classify_page_ = !was_restored;
     }
   }
 }
 
 void AdsTabHelper::DocumentOnLoadCompletedInMainFrame() {
-  // don't start distilling is the ad service isn't enabled
-  if (!ads_service_ || !ads_service_->IsAdsEnabled() || !run_distiller_)
+  // don't extract the page text if the ad service isn't enabled
+  if (!ads_service_ || !ads_service_->IsAdsEnabled() || !should_classify_page_)
     return;
 
-  auto* dom_distiller_service =
-      dom_distiller::DomDistillerServiceFactory::GetForBrowserContext(
-          web_contents()->GetBrowserContext());
+  const GURL& url = web_contents()->GetLastCommittedURL();
 
-  if (!dom_distiller_service)
-    return;
+  // Ask Ads first so that pages which would be rejected anyway, i.e.
+  // unsupported URLs, search engines or the site of the last shown
+  // notification, are never extracted
+  ads_service_->ShouldClassifyPage(url.spec(),
+      base::BindOnce(&AdsTabHelper::OnShouldClassifyPage,
+          weak_factory_.GetWeakPtr(), url));
+}
 
-  auto source_page_handle =
-      std::make_unique<dom_distiller::SourcePageHandleWebContents>(
-          web_contents(), false);
+void AdsTabHelper::OnShouldClassifyPage(
+    const GURL& url,
+    const bool should_classify) {
+  if (!ads_service_)
+    return;
 
-  auto distiller_page =
-      dom_distiller_service->CreateDefaultDistillerPageWithHandle(
-          std::move(source_page_handle));
+  if (!should_classify) {
+    ads_service_->ClassifyPage(url.spec(), std::string());
+    return;
+  }
 
-  auto options = dom_distiller::proto::DomDistillerOptions();
-  // options.set_extract_text_only(true);
-  // options.set_debug_level(1);
+  // The tab navigated away while waiting for Ads
+  if (web_contents()->GetLastCommittedURL() != url)
+    return;
 
-  auto* distiller_page_ptr = distiller_page.get();
+  const std::string script = base::StringPrintf(kExtractPageTextScript,
+      2 * kMaximumPageTextLength, kMaximumPageTextLength);
 
-  distiller_page_ptr->DistillPage(
-      web_contents()->GetLastCommittedURL(),
-      options,
-      base::Bind(&AdsTabHelper::OnWebContentsDistillationDone,
-          weak_factory_.GetWeakPtr(),
-          web_contents()->GetLastCommittedURL(),
-          base::Passed(std::move(distiller_page))));
+  web_contents()->GetMainFrame()->ExecuteJavaScriptInIsolatedWorld(
+      base::UTF8ToUTF16(script),
+      base::BindOnce(&AdsTabHelper::OnPageTextExtracted,
+          weak_factory_.GetWeakPtr(), url),
+      ISOLATED_WORLD_ID_BRAVE_ADS);
 }
 
-void AdsTabHelper::OnWebContentsDistillationDone(
+void AdsTabHelper::OnPageTextExtracted(
     const GURL& url,
-    std::unique_ptr<dom_distiller::DistillerPage> distiller_page,
-    std::unique_ptr<dom_distiller::proto::DomDistillerResult> distiller_result,
-    bool distillation_successful) {
-  if (!ads_service_ )
+    base::Value value) {
+  if (!ads_service_ || !value.is_string())
     return;
 
-  if (distillation_successful &&
-      distiller_result->has_distilled_content() &&
-      distiller_result->has_markup_info() &&
-      distiller_result->distilled_content().has_html()) {
-    ads_service_->ClassifyPage(url.spec(),
-                               distiller_result->distilled_content().html());
-  } else {
-    // TODO(bridiver) - fall back to web_contents()->GenerateMHTML or ignore?
-  }
+  std::string text;
+  base::TruncateUTF8ToByteSize(value.GetString(), kMaximumPageTextLength,
+      &text);
+
+  ads_service_->ClassifyPage(url.spec(), text);
 }
 
 void AdsTabHelper::DidFinishLoad(
@@ -6,7 +6,6 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_ADS_TAB_HELPER_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_ADS_TAB_HELPER_H_
 
-#include <memory>
 #include <string>
 
 #include "base/macros.h"
@@ -20,15 +19,9 @@
 
 class Browser;
 
-namespace dom_distiller {
-
-class DistillerPage;
-
-namespace proto {
-class DomDistillerResult;
-}  // namespace proto
-
-}  // namespace dom_distiller
+namespace base {
+class Value;
+}  // namespace base
 
 namespace brave_ads {
 
@@ -70,17 +63,18 @@ class AdsTabHelper : public content::WebContentsObserver,
   void OnBrowserNoLongerActive(Browser* browser) override;
 #endif
 
-  void OnWebContentsDistillationDone(
+  void OnShouldClassifyPage(
+      const GURL& url,
+      const bool should_classify);
+  void OnPageTextExtracted(
       const GURL& url,
-      std::unique_ptr<dom_distiller::DistillerPage>,
-      std::unique_ptr<dom_distiller::proto::DomDistillerResult> result,
-      bool distillation_successful);
+      base::Value value);
 
   SessionID tab_id_;
   AdsService* ads_service_;  // NOT OWNED
   bool is_active_;
   bool is_browser_active_;
-  bool run_distiller_;
+  bool should_classify_page_;
 
   base::WeakPtrFactory<AdsTabHelper> weak_factory_;
 
@@ -0,0 +1,147 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures BundleStateDatabase::SaveBundleState for a new catalog, for the
+// next version of it with 1% of the creatives changed and for the same
+// version saved again.
+//
+// ninja -C out/Release brave/components/brave_ads/browser:brave_ads_bundle_state_database_benchmark
+// out/Release/brave_ads_bundle_state_database_benchmark
+//
+// Switches:
+//   --creatives=<n>       creatives in the catalog (1000, 10000 and 100000)
+//   --iterations=<n>      times each save is measured (5)
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/at_exit.h"
+#include "base/command_line.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "bat/ads/ad_info.h"
+#include "bat/ads/bundle_state.h"
+#include "brave/components/brave_ads/browser/bundle_state_database.h"
+#include "brave_base/benchmark_util.h"
+
+using brave_base::benchmark::GetSwitchValueAsUint64;
+using brave_base::benchmark::Median;
+
+namespace {
+
+const char kCreativesSwitch[] = "creatives";
+const char kIterationsSwitch[] = "iterations";
+
+ads::AdInfo CreateAdInfo(const size_t index) {
+  ads::AdInfo info;
+  info.creative_set_id = "creative_set_" + base::NumberToString(index);
+  info.campaign_id = "campaign_" + base::NumberToString(index);
+  info.start_timestamp = "2000-01-01 00:00:00";
+  info.end_timestamp = "2100-01-01 00:00:00";
+  info.daily_cap = 1;
+  info.per_day = 2;
+  info.total_max = 3;
+  info.regions = {"US", "GB"};
+  info.advertiser = "advertiser";
+  info.notification_text = "text";
+  info.notification_url = "https://brave.com";
+  info.uuid = "uuid_" + base::NumberToString(index);
+  return info;
+}
+
+// Creates a catalog with |count| creatives spread over 10 categories. Later
+// versions change the text of 1% of them
+ads::BundleState CreateBundleState(
+    const uint64_t count,
+    const uint64_t catalog_version) {
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog";
+  bundle_state.catalog_version = catalog_version;
+
+  for (uint64_t i = 0; i < count; i++) {
+    const std::string category = "category-" + base::NumberToString(i % 10);
+    ads::AdInfo info = CreateAdInfo(i);
+    if (catalog_version > 1 && i % 100 == 0) {
+      info.notification_text = "updated";
+    }
+
+    bundle_state.categories[category].push_back(info);
+  }
+
+  return bundle_state;
+}
+
+base::TimeDelta TimeSave(
+    brave_ads::BundleStateDatabase* database,
+    const ads::BundleState& bundle_state) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  if (!database->SaveBundleState(bundle_state)) {
+    std::cerr << "Failed to save the bundle state" << std::endl;
+  }
+
+  return base::TimeTicks::Now() - start;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  base::AtExitManager at_exit_manager;
+  base::CommandLine::Init(argc, argv);
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+
+  std::vector<uint64_t> counts = {1000, 10000, 100000};
+  if (command_line.HasSwitch(kCreativesSwitch)) {
+    counts = {GetSwitchValueAsUint64(command_line, kCreativesSwitch, 1000)};
+  }
+
+  const uint64_t iterations = std::max<uint64_t>(1,
+      GetSwitchValueAsUint64(command_line, kIterationsSwitch, 5));
+
+  base::ScopedTempDir temp_dir;
+  if (!temp_dir.CreateUniqueTempDir()) {
+    std::cerr << "Failed to create a temporary directory" << std::endl;
+    return 1;
+  }
+
+  brave_ads::BundleStateDatabase database(
+      temp_dir.GetPath().AppendASCII("bundle_state_benchmark.db"));
+
+  std::cout << std::setw(10) << "creatives" << std::setw(14) << "initial"
+      << std::setw(14) << "1% changed" << std::setw(14) << "unchanged"
+      << std::endl;
+
+  for (const uint64_t count : counts) {
+    const ads::BundleState bundle_state = CreateBundleState(count, 1);
+    const ads::BundleState updated_bundle_state = CreateBundleState(count, 2);
+
+    std::vector<base::TimeDelta> initial_samples;
+    std::vector<base::TimeDelta> update_samples;
+    std::vector<base::TimeDelta> unchanged_samples;
+    for (uint64_t i = 0; i < iterations; i++) {
+      // An empty bundle resets the database and its catalog state
+      TimeSave(&database, ads::BundleState());
+
+      initial_samples.push_back(TimeSave(&database, bundle_state));
+      update_samples.push_back(TimeSave(&database, updated_bundle_state));
+      unchanged_samples.push_back(TimeSave(&database, updated_bundle_state));
+    }
+
+    std::cout << std::setw(10) << count << std::fixed << std::setprecision(1)
+        << std::setw(11) << Median(initial_samples).InMillisecondsF() << " ms"
+        << std::setw(11) << Median(update_samples).InMillisecondsF() << " ms"
+        << std::setw(11) << Median(unchanged_samples).InMillisecondsF()
+        << " ms" << std::endl;
+  }
+
+  return 0;
+}
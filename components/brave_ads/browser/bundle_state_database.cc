@@ -7,12 +7,18 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/bind.h"
 #include "base/files/file_util.h"
+#include "base/hash.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "build/build_config.h"
 #include "sql/meta_table.h"
 #include "sql/statement.h"
@@ -22,9 +28,90 @@ namespace brave_ads {
 
 namespace {
 
-const int kCurrentVersionNumber = 2;
+const int kCurrentVersionNumber = 3;
 const int kCompatibleVersionNumber = 2;
 
+const char kCatalogIdKey[] = "catalog_id";
+const char kCatalogVersionKey[] = "catalog_version";
+
+// Number of rows bound to a single multi-row INSERT. ad_info has 13 bound
+// columns so a full batch stays well below SQLITE_MAX_VARIABLE_NUMBER
+const size_t kInsertBatchSize = 50;
+
+std::string BuildInsertStatement(
+    const char* insert,
+    const char* values,
+    const size_t rows) {
+  std::string sql = insert;
+  for (size_t i = 0; i < rows; i++) {
+    if (i > 0) {
+      sql.append(", ");
+    }
+
+    sql.append(values);
+  }
+
+  return sql;
+}
+
+// Runs |rows| through multi-row INSERT statements of up to |kInsertBatchSize|
+// rows. Full batches reuse the statement cached under |id|, only the trailing
+// partial batch is prepared on the fly. |bind| binds a single row starting at
+// the given column index and returns the index of the next free column
+template <typename Row, typename BindRow>
+bool RunBatchedInsert(
+    sql::Database* db,
+    const sql::StatementID& id,
+    const char* insert,
+    const char* values,
+    const std::vector<Row>& rows,
+    BindRow bind) {
+  size_t offset = 0;
+  while (offset < rows.size()) {
+    const size_t count = std::min(kInsertBatchSize, rows.size() - offset);
+    const std::string sql = BuildInsertStatement(insert, values, count);
+
+    sql::Statement statement;
+    if (count == kInsertBatchSize) {
+      statement.Assign(db->GetCachedStatement(id, sql.c_str()));
+    } else {
+      statement.Assign(db->GetUniqueStatement(sql.c_str()));
+    }
+
+    int column = 0;
+    for (size_t i = offset; i < offset + count; i++) {
+      column = bind(&statement, column, rows.at(i));
+    }
+
+    if (!statement.Run()) {
+      return false;
+    }
+
+    offset += count;
+  }
+
+  return true;
+}
+
+// Identifies the content of an ad, excluding the (region, uuid) primary key,
+// so that unchanged creatives can be skipped when a new catalog is applied
+int64_t GetAdInfoFingerprint(const ads::AdInfo& info) {
+  const std::string content = base::JoinString({
+      info.creative_set_id,
+      info.campaign_id,
+      info.start_timestamp,
+      info.end_timestamp,
+      base::NumberToString(info.daily_cap),
+      base::NumberToString(info.per_day),
+      base::NumberToString(info.total_max),
+      info.advertiser,
+      info.notification_text,
+      info.notification_url
+  }, "\x1f");
+
+  return base::PersistentHash(content);
+}
+
 }  // namespace
 
 BundleStateDatabase::BundleStateDatabase(const base::FilePath& db_path) :
@@ -139,6 +226,7 @@ bool BundleStateDatabase::CreateAdInfoTable() {
       "daily_cap INTEGER DEFAULT 0 NOT NULL,"
       "per_day INTEGER DEFAULT 0 NOT NULL,"
       "total_max INTEGER DEFAULT 0 NOT NULL,"
+      "fingerprint INTEGER DEFAULT 0 NOT NULL,"
       "PRIMARY KEY(region, uuid))");
   return GetDB().Execute(sql.c_str());
 }
@@ -215,125 +303,276 @@ bool BundleStateDatabase::SaveBundleState(
   if (!initialized)
     return false;
 
+  if (IsCatalogUpToDate(bundle_state))
+    return true;
+
   if (!GetDB().BeginTransaction())
     return false;
 
-  // we are completely replacing here so first truncate all the tables
-  if (!TruncateAdInfoCategoryTable() ||
-      !TruncateAdInfoTable() ||
-      !TruncateCategoryTable()) {
+  bool success;
+  if (bundle_state.categories.empty()) {
+    // Resetting the bundle, so there is nothing to diff against
+    success = TruncateAdInfoCategoryTable() &&
+        TruncateAdInfoTable() &&
+        TruncateCategoryTable();
+  } else {
+    success = UpdateCategories(bundle_state) &&
+        UpdateAdInfo(bundle_state) &&
+        UpdateAdInfoCategories(bundle_state);
+  }
+
+  if (!success || !SetCatalogState(bundle_state)) {
     GetDB().RollbackTransaction();
     return false;
   }
 
-  auto categories = bundle_state.categories;
-  for (std::map<std::string, std::vector<ads::AdInfo>>::iterator it =
-      categories.begin();  it != categories.end(); ++it) {
-    auto category = it->first;
-    if (!InsertOrUpdateCategory(category)) {
-      GetDB().RollbackTransaction();
-      return false;
-    }
+  return GetDB().CommitTransaction();
+}
 
-    auto ads = it->second;
-    for (std::vector<ads::AdInfo>::iterator ad_it = ads.begin();
-        ad_it != ads.end(); ++ad_it) {
-      auto ad_info = *ad_it;
-      if (!InsertOrUpdateAdInfo(ad_info) ||
-          !InsertOrUpdateAdInfoCategory(ad_info, category)) {
-        GetDB().RollbackTransaction();
-        return false;
-      }
+bool BundleStateDatabase::IsCatalogUpToDate(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (bundle_state.catalog_id.empty() || bundle_state.catalog_version == 0)
+    return false;
+
+  std::string catalog_id;
+  int64_t catalog_version;
+  if (!GetMetaTable().GetValue(kCatalogIdKey, &catalog_id) ||
+      !GetMetaTable().GetValue(kCatalogVersionKey, &catalog_version)) {
+    return false;
+  }
+
+  return catalog_id == bundle_state.catalog_id &&
+      static_cast<uint64_t>(catalog_version) == bundle_state.catalog_version;
+}
+
+bool BundleStateDatabase::SetCatalogState(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return GetMetaTable().SetValue(kCatalogIdKey, bundle_state.catalog_id) &&
+      GetMetaTable().SetValue(kCatalogVersionKey,
+          static_cast<int64_t>(bundle_state.catalog_version));
+}
+
+bool BundleStateDatabase::UpdateCategories(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  std::set<std::string> stale_categories;
+
+  sql::Statement select(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT name FROM category"));
+  while (select.Step()) {
+    stale_categories.insert(select.ColumnString(0));
+  }
+
+  std::vector<const std::string*> new_categories;
+  for (const auto& category : bundle_state.categories) {
+    if (stale_categories.erase(category.first) == 0) {
+      new_categories.push_back(&category.first);
     }
   }
 
-  if (GetDB().CommitTransaction()) {
-    Vacuum();
-    return true;
+  for (const auto& category : stale_categories) {
+    if (!DeleteCategory(category)) {
+      return false;
+    }
   }
 
-  return false;
+  return InsertOrUpdateCategories(new_categories);
 }
 
-bool BundleStateDatabase::InsertOrUpdateCategory(const std::string& category) {
+bool BundleStateDatabase::UpdateAdInfo(
+    const ads::BundleState& bundle_state) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  bool initialized = Init();
-  DCHECK(initialized);
+  // (region, uuid) -> fingerprint of the stored row
+  std::map<std::pair<std::string, std::string>, int64_t> stale_ads;
 
-  if (!initialized)
-    return false;
+  sql::Statement select(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT region, uuid, fingerprint FROM ad_info"));
+  while (select.Step()) {
+    stale_ads.emplace(
+        std::make_pair(select.ColumnString(0), select.ColumnString(1)),
+        select.ColumnInt64(2));
+  }
 
-  sql::Statement ad_info_statement(
-      GetDB().GetCachedStatement(SQL_FROM_HERE,
-          "INSERT OR REPLACE INTO category "
-          "(name) "
-          "VALUES (?)"));
+  // The same ad is listed once per category it belongs to, so keep track of
+  // the rows we have already visited
+  std::set<std::pair<std::string, std::string>> visited_ads;
+  std::vector<AdInfoRow> changed_ads;
+
+  for (const auto& category : bundle_state.categories) {
+    for (const auto& ad_info : category.second) {
+      const int64_t fingerprint = GetAdInfoFingerprint(ad_info);
+
+      for (const auto& region : ad_info.regions) {
+        auto key = std::make_pair(region, ad_info.uuid);
+        if (!visited_ads.insert(key).second) {
+          continue;
+        }
+
+        auto it = stale_ads.find(key);
+        if (it != stale_ads.end()) {
+          const bool changed = it->second != fingerprint;
+          stale_ads.erase(it);
+          if (!changed) {
+            continue;
+          }
+        }
+
+        changed_ads.push_back({&ad_info, &region, fingerprint});
+      }
+    }
+  }
 
-  ad_info_statement.BindString(0, category);
+  for (const auto& ad : stale_ads) {
+    if (!DeleteAdInfo(ad.first.first, ad.first.second)) {
+      return false;
+    }
+  }
 
-  return ad_info_statement.Run();
+  return InsertOrUpdateAdInfo(changed_ads);
 }
 
-bool BundleStateDatabase::InsertOrUpdateAdInfo(const ads::AdInfo& info) {
+bool BundleStateDatabase::UpdateAdInfoCategories(
+    const ads::BundleState& bundle_state) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  bool initialized = Init();
-  DCHECK(initialized);
+  // (uuid, category)
+  std::set<std::pair<std::string, std::string>> stale_ad_categories;
 
-  if (!initialized)
-    return false;
+  sql::Statement select(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT ad_info_uuid, category_name FROM ad_info_category"));
+  while (select.Step()) {
+    stale_ad_categories.emplace(select.ColumnString(0),
+        select.ColumnString(1));
+  }
+
+  std::set<std::pair<std::string, std::string>> visited_ad_categories;
+  std::vector<AdInfoCategoryRow> new_ad_categories;
+
+  for (const auto& category : bundle_state.categories) {
+    for (const auto& ad_info : category.second) {
+      auto key = std::make_pair(ad_info.uuid, category.first);
+      if (!visited_ad_categories.insert(key).second) {
+        continue;
+      }
+
+      if (stale_ad_categories.erase(key) == 0) {
+        new_ad_categories.push_back({&ad_info.uuid, &category.first});
+      }
+    }
+  }
 
-  for (auto it = info.regions.begin(); it != info.regions.end(); ++it) {
-    sql::Statement ad_info_statement(
-        GetDB().GetCachedStatement(SQL_FROM_HERE,
-            "INSERT OR REPLACE INTO ad_info "
-            "(creative_set_id, advertiser, notification_text, "
-            "notification_url, start_timestamp, end_timestamp, uuid, "
-            "campaign_id, daily_cap, per_day, total_max, region) "
-            "VALUES (?, ?, ?, ?, datetime(?), datetime(?), ?, ?, ?, ?, ?, ?)"));
-
-    ad_info_statement.BindString(0, info.creative_set_id);
-    ad_info_statement.BindString(1, info.advertiser);
-    ad_info_statement.BindString(2, info.notification_text);
-    ad_info_statement.BindString(3, info.notification_url);
-    ad_info_statement.BindString(4, info.start_timestamp);
-    ad_info_statement.BindString(5, info.end_timestamp);
-    ad_info_statement.BindString(6, info.uuid);
-    ad_info_statement.BindString(7, info.campaign_id);
-    ad_info_statement.BindInt(8, info.daily_cap);
-    ad_info_statement.BindInt(9, info.per_day);
-    ad_info_statement.BindInt(10, info.total_max);
-    ad_info_statement.BindString(11, *it);
-    if (!ad_info_statement.Run()) {
+  for (const auto& ad_category : stale_ad_categories) {
+    if (!DeleteAdInfoCategory(ad_category.first, ad_category.second)) {
       return false;
     }
   }
 
-  return true;
+  return InsertOrUpdateAdInfoCategories(new_ad_categories);
+}
+
+bool BundleStateDatabase::DeleteCategory(const std::string& category) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM category WHERE name = ?"));
+  statement.BindString(0, category);
+
+  return statement.Run();
 }
 
-bool BundleStateDatabase::InsertOrUpdateAdInfoCategory(
-    const ads::AdInfo& ad_info,
+bool BundleStateDatabase::DeleteAdInfo(
+    const std::string& region,
+    const std::string& uuid) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info WHERE region = ? AND uuid = ?"));
+  statement.BindString(0, region);
+  statement.BindString(1, uuid);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::DeleteAdInfoCategory(
+    const std::string& uuid,
     const std::string& category) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  bool initialized = Init();
-  DCHECK(initialized);
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info_category "
+      "WHERE ad_info_uuid = ? AND category_name = ?"));
+  statement.BindString(0, uuid);
+  statement.BindString(1, category);
 
-  if (!initialized)
-    return false;
+  return statement.Run();
+}
 
-  sql::Statement ad_info_statement(
-      GetDB().GetCachedStatement(SQL_FROM_HERE,
-          "INSERT OR REPLACE INTO ad_info_category "
-          "(ad_info_uuid, category_name) "
-          "VALUES (?, ?)"));
+bool BundleStateDatabase::InsertOrUpdateCategories(
+    const std::vector<const std::string*>& categories) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  ad_info_statement.BindString(0, ad_info.uuid);
-  ad_info_statement.BindString(1, category);
+  return RunBatchedInsert(&GetDB(), SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO category (name) VALUES ",
+      "(?)",
+      categories,
+      [](sql::Statement* statement, int column, const std::string* category) {
+        statement->BindString(column++, *category);
+        return column;
+      });
+}
+
+bool BundleStateDatabase::InsertOrUpdateAdInfo(
+    const std::vector<AdInfoRow>& rows) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  return ad_info_statement.Run();
+  return RunBatchedInsert(&GetDB(), SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO ad_info "
+      "(creative_set_id, advertiser, notification_text, "
+      "notification_url, start_timestamp, end_timestamp, uuid, "
+      "campaign_id, daily_cap, per_day, total_max, region, fingerprint) "
+      "VALUES ",
+      "(?, ?, ?, ?, datetime(?), datetime(?), ?, ?, ?, ?, ?, ?, ?)",
+      rows,
+      [](sql::Statement* statement, int column, const AdInfoRow& row) {
+        const ads::AdInfo& info = *row.info;
+        statement->BindString(column++, info.creative_set_id);
+        statement->BindString(column++, info.advertiser);
+        statement->BindString(column++, info.notification_text);
+        statement->BindString(column++, info.notification_url);
+        statement->BindString(column++, info.start_timestamp);
+        statement->BindString(column++, info.end_timestamp);
+        statement->BindString(column++, info.uuid);
+        statement->BindString(column++, info.campaign_id);
+        statement->BindInt(column++, info.daily_cap);
+        statement->BindInt(column++, info.per_day);
+        statement->BindInt(column++, info.total_max);
+        statement->BindString(column++, *row.region);
+        statement->BindInt64(column++, row.fingerprint);
+        return column;
+      });
+}
+
+bool BundleStateDatabase::InsertOrUpdateAdInfoCategories(
+    const std::vector<AdInfoCategoryRow>& rows) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return RunBatchedInsert(&GetDB(), SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO ad_info_category "
+      "(ad_info_uuid, category_name) "
+      "VALUES ",
+      "(?, ?)",
+      rows,
+      [](sql::Statement* statement, int column, const AdInfoCategoryRow& row) {
+        statement->BindString(column++, *row.first);
+        statement->BindString(column++, *row.second);
+        return column;
+      });
 }
 
 bool BundleStateDatabase::GetAdsForCategory(
@@ -450,12 +689,17 @@ bool BundleStateDatabase::MigrateV1toV2() {
     return false;
   }
 
-  if (GetDB().CommitTransaction()) {
-    Vacuum();
-    return true;
-  }
+  return GetDB().CommitTransaction();
+}
 
-  return false;
+bool BundleStateDatabase::MigrateV2toV3() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Existing rows get a fingerprint of 0 so they are rewritten by the next
+  // catalog update
+  const char sql[] =
+      "ALTER TABLE ad_info ADD fingerprint INTEGER DEFAULT 0 NOT NULL;";
+  return GetDB().Execute(sql);
 }
 
 sql::InitStatus BundleStateDatabase::EnsureCurrentVersion() {
@@ -471,11 +715,20 @@ sql::InitStatus BundleStateDatabase::EnsureCurrentVersion() {
   const int cur_version = GetCurrentVersion();
 
   // Migration from version 1 to version 2
-  if (old_version == 1 && cur_version == 2) {
+  if (old_version < 2 && cur_version >= 2) {
     if (!MigrateV1toV2()) {
       LOG(ERROR) << "DB: Error with MigrateV1toV2";
     }
+  }
+
+  // Migration from version 2 to version 3
+  if (old_version < 3 && cur_version >= 3) {
+    if (!MigrateV2toV3()) {
+      LOG(ERROR) << "DB: Error with MigrateV2toV3";
+    }
+  }
 
+  if (old_version < cur_version) {
     meta_table_.SetVersionNumber(cur_version);
   }
 
@@ -7,7 +7,11 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_BUNDLE_STATE_DATABASE_H_
 
 #include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -36,6 +40,9 @@ class BundleStateDatabase {
     db_.set_error_callback(error_callback);
   }
 
+  // Applies |bundle_state| as a diff against the stored bundle: rows for
+  // creatives that did not change are left untouched and the whole update is
+  // skipped if the stored catalog id and version already match
   bool SaveBundleState(const ads::BundleState& bundle_state);
   bool GetAdsForCategory(
       const std::string& category,
@@ -64,16 +71,38 @@ class BundleStateDatabase {
   bool TruncateAdInfoTable();
   bool TruncateAdInfoCategoryTable();
 
-  bool InsertOrUpdateCategory(const std::string& category);
-  bool InsertOrUpdateAdInfo(const ads::AdInfo& info);
-  bool InsertOrUpdateAdInfoCategory(
-      const ads::AdInfo& ad_info,
+  bool IsCatalogUpToDate(const ads::BundleState& bundle_state);
+  bool SetCatalogState(const ads::BundleState& bundle_state);
+
+  bool UpdateCategories(const ads::BundleState& bundle_state);
+  bool UpdateAdInfo(const ads::BundleState& bundle_state);
+  bool UpdateAdInfoCategories(const ads::BundleState& bundle_state);
+
+  bool DeleteCategory(const std::string& category);
+  bool DeleteAdInfo(const std::string& region, const std::string& uuid);
+  bool DeleteAdInfoCategory(
+      const std::string& uuid,
       const std::string& category);
 
+  bool InsertOrUpdateCategories(
+      const std::vector<const std::string*>& categories);
+
+  struct AdInfoRow {
+    const ads::AdInfo* info;  // NOT OWNED
+    const std::string* region;  // NOT OWNED
+    int64_t fingerprint;
+  };
+  bool InsertOrUpdateAdInfo(const std::vector<AdInfoRow>& rows);
+
+  using AdInfoCategoryRow = std::pair<const std::string*, const std::string*>;
+  bool InsertOrUpdateAdInfoCategories(
+      const std::vector<AdInfoCategoryRow>& rows);
+
   sql::Database& GetDB();
   sql::MetaTable& GetMetaTable();
 
   bool MigrateV1toV2();
+  bool MigrateV2toV3();
   sql::InitStatus EnsureCurrentVersion();
 
   sql::Database db_;
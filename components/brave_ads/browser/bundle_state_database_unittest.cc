@@ -0,0 +1,141 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "brave/components/brave_ads/browser/bundle_state_database.h"
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
+#include "bat/ads/ad_info.h"
+#include "bat/ads/bundle_state.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BundleStateDatabaseTest.*
+
+namespace brave_ads {
+
+class BundleStateDatabaseTest : public ::testing::Test {
+ protected:
+  BundleStateDatabaseTest() {
+  }
+
+  ~BundleStateDatabaseTest() override {
+  }
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    bundle_state_database_ = std::make_unique<BundleStateDatabase>(
+        temp_dir_.GetPath().AppendASCII("BundleStateDatabaseTest.db"));
+  }
+
+  ads::AdInfo CreateAdInfo(const size_t index) {
+    ads::AdInfo info;
+    info.creative_set_id = "creative_set_" + base::NumberToString(index);
+    info.campaign_id = "campaign_" + base::NumberToString(index);
+    info.start_timestamp = "2000-01-01 00:00:00";
+    info.end_timestamp = "2100-01-01 00:00:00";
+    info.daily_cap = 1;
+    info.per_day = 2;
+    info.total_max = 3;
+    info.regions = {"US", "GB"};
+    info.advertiser = "advertiser";
+    info.notification_text = "text";
+    info.notification_url = "https://brave.com";
+    info.uuid = "uuid_" + base::NumberToString(index);
+    return info;
+  }
+
+  // Creates a bundle with |count| creatives spread over 10 categories
+  std::unique_ptr<ads::BundleState> CreateBundleState(
+      const size_t count,
+      const uint64_t catalog_version) {
+    auto bundle_state = std::make_unique<ads::BundleState>();
+    bundle_state->catalog_id = "catalog";
+    bundle_state->catalog_version = catalog_version;
+
+    for (size_t i = 0; i < count; i++) {
+      const std::string category = "category-" + base::NumberToString(i % 10);
+      bundle_state->categories[category].push_back(CreateAdInfo(i));
+    }
+
+    return bundle_state;
+  }
+
+  size_t CountAdsForCategory(const std::string& category) {
+    std::vector<ads::AdInfo> ads;
+    EXPECT_TRUE(bundle_state_database_->GetAdsForCategory(category, &ads));
+    return ads.size();
+  }
+
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<BundleStateDatabase> bundle_state_database_;
+};
+
+TEST_F(BundleStateDatabaseTest, SaveBundleState) {
+  auto bundle_state = CreateBundleState(100, 1);
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*bundle_state));
+
+  // Each ad is stored for two regions
+  EXPECT_EQ(20u, CountAdsForCategory("category-0"));
+  EXPECT_EQ(0u, CountAdsForCategory("category-10"));
+}
+
+TEST_F(BundleStateDatabaseTest, SaveBundleStateAppliesDiff) {
+  auto bundle_state = CreateBundleState(100, 1);
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*bundle_state));
+
+  // Remove a whole category and change the content of another ad
+  auto updated_bundle_state = CreateBundleState(100, 2);
+  updated_bundle_state->categories.erase("category-1");
+  updated_bundle_state->categories["category-0"].front().notification_text =
+      "updated";
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*updated_bundle_state));
+
+  EXPECT_EQ(0u, CountAdsForCategory("category-1"));
+
+  std::vector<ads::AdInfo> ads;
+  EXPECT_TRUE(bundle_state_database_->GetAdsForCategory("category-0", &ads));
+  EXPECT_EQ(20u, ads.size());
+  size_t updated_ads = 0;
+  for (const auto& ad : ads) {
+    if (ad.notification_text == "updated") {
+      updated_ads++;
+    }
+  }
+  EXPECT_EQ(2u, updated_ads);
+}
+
+TEST_F(BundleStateDatabaseTest, SaveBundleStateSkipsUnchangedCatalog) {
+  auto bundle_state = CreateBundleState(100, 1);
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*bundle_state));
+
+  // Same catalog id and version, so the content must not be applied
+  auto same_catalog_bundle_state = CreateBundleState(10, 1);
+  EXPECT_TRUE(
+      bundle_state_database_->SaveBundleState(*same_catalog_bundle_state));
+
+  EXPECT_EQ(20u, CountAdsForCategory("category-0"));
+}
+
+TEST_F(BundleStateDatabaseTest, ResetBundleState) {
+  auto bundle_state = CreateBundleState(100, 1);
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*bundle_state));
+
+  ads::BundleState empty_bundle_state;
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(empty_bundle_state));
+
+  EXPECT_EQ(0u, CountAdsForCategory("category-0"));
+
+  // The catalog state is reset too, so saving the first catalog again must
+  // not be skipped
+  EXPECT_TRUE(bundle_state_database_->SaveBundleState(*bundle_state));
+  EXPECT_EQ(20u, CountAdsForCategory("category-0"));
+}
+
+}  // namespace brave_ads
@@ -7,7 +7,11 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "base/task/post_task.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
@@ -43,11 +47,33 @@ content::WebContents* GetWebContents(
   return web_contents;
 }
 
+// Twitch sends its events form encoded as data=<base64>, and Vimeo as a JSON
+// list. For Twitch only the data field is kept, so the rest of the body isn't
+// copied to the UI thread
+std::string GetPostData(const std::vector<base::StringPiece>& chunks) {
+  const base::StringPiece kTwitchField = "data=";
+
+  std::string post_data;
+  for (const auto& chunk : chunks) {
+    chunk.AppendToString(&post_data);
+  }
+
+  if (base::StartsWith(post_data, kTwitchField,
+                       base::CompareCase::SENSITIVE)) {
+    const size_t end = post_data.find('&');
+    if (end != std::string::npos) {
+      post_data.resize(end);
+    }
+  }
+
+  return post_data;
+}
+
 void DispatchOnUI(
-    const std::string post_data,
-    const GURL url,
-    const GURL first_party_url,
-    const std::string referrer,
+    const std::string& post_data,
+    const GURL& url,
+    const GURL& first_party_url,
+    const GURL& referrer,
     int render_process_id,
     int render_frame_id,
     int frame_tree_node_id) {
@@ -67,7 +93,7 @@ void DispatchOnUI(
   if (rewards_service)
     rewards_service->OnPostData(tab_helper->session_id(),
                                 url, first_party_url,
-                                GURL(referrer), post_data);
+                                referrer, post_data);
 }
 
 }  // namespace
@@ -77,18 +103,29 @@ int OnBeforeURLRequest(
   std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
 
-  if (IsMediaLink(ctx->request_url, ctx->tab_origin, ctx->referrer)) {
-    if (!ctx->upload_data.empty()) {
-      base::PostTaskWithTraits(FROM_HERE, {content::BrowserThread::UI},
-          base::BindOnce(&DispatchOnUI,
-                         ctx->upload_data,
-                         ctx->request_url,
-                         ctx->tab_url,
-                         ctx->referrer.spec(),
-                         ctx->render_process_id,
-                         ctx->render_frame_id,
-                         ctx->frame_tree_node_id));
-    }
+  // Only media events are read, so check the link before the body
+  if (!ctx->upload_data ||
+      !IsMediaLink(ctx->request_url, ctx->tab_origin, ctx->referrer)) {
+    return net::OK;
+  }
+
+  std::vector<base::StringPiece> chunks;
+  if (!ctx->GetUploadData(&chunks)) {
+    return net::OK;
+  }
+
+  // The body is untrusted, so it is only forwarded here. The ledger parses it
+  std::string post_data = GetPostData(chunks);
+  if (!post_data.empty()) {
+    base::PostTaskWithTraits(FROM_HERE, {content::BrowserThread::UI},
+        base::BindOnce(&DispatchOnUI,
+                       std::move(post_data),
+                       ctx->request_url,
+                       ctx->tab_url,
+                       ctx->referrer,
+                       ctx->render_process_id,
+                       ctx->render_frame_id,
+                       ctx->frame_tree_node_id));
   }
 
   return net::OK;
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -26,9 +27,57 @@ namespace brave_rewards {
 
 namespace {
 
-const int kCurrentVersionNumber = 6;
+const int kCurrentVersionNumber = 7;
 const int kCompatibleVersionNumber = 1;
 
+// Columns the activity list can be ordered by. Anything else is rejected, so
+// the number of distinct activity list queries stays bounded
+const char* const kActivityListOrderColumns[] = {
+  "ai.publisher_id",
+  "ai.duration",
+  "ai.visits",
+  "ai.score",
+  "ai.percent",
+  "ai.weight",
+  "ai.reconcile_stamp",
+  "pi.verified",
+  "pi.excluded",
+  "pi.name",
+  "pi.url",
+  "pi.provider"
+};
+
+bool IsActivityListOrderColumn(const std::string& column) {
+  for (const char* order_column : kActivityListOrderColumns) {
+    if (column == order_column) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Adds the time until it goes out of scope to |stats|
+class ScopedQueryTimer {
+ public:
+  explicit ScopedQueryTimer(PublisherInfoDatabase::QueryStats* stats)
+      : stats_(stats),
+        start_time_(base::TimeTicks::Now()) {}
+
+  ~ScopedQueryTimer() {
+    const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time_;
+    stats_->count++;
+    stats_->total_time += elapsed;
+    stats_->max_time = std::max(stats_->max_time, elapsed);
+  }
+
+ private:
+  PublisherInfoDatabase::QueryStats* stats_;
+  const base::TimeTicks start_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedQueryTimer);
+};
+
 }  // namespace
 
 PublisherInfoDatabase::PublisherInfoDatabase(const base::FilePath& db_path) :
@@ -146,6 +195,8 @@ bool PublisherInfoDatabase::InsertContributionInfo(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertContributionInfo"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
       "INSERT INTO contribution_info "
       "(publisher_id, probi, date, "
@@ -174,6 +225,8 @@ void PublisherInfoDatabase::GetOneTimeTips(ledger::PublisherInfoList* list,
     return;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetOneTimeTips"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
       "ci.probi, ci.date, pi.verified, pi.provider "
@@ -243,6 +296,8 @@ bool PublisherInfoDatabase::InsertOrUpdatePublisherInfo(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertOrUpdatePublisherInfo"]);
+
   sql::Transaction transaction(&GetDB());
   if (!transaction.Begin()) {
     return false;
@@ -300,6 +355,8 @@ PublisherInfoDatabase::GetPublisherInfo(const std::string& publisher_key) {
     return nullptr;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetPublisherInfo"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT publisher_id, name, url, favIcon, provider, verified, excluded "
       "FROM publisher_info WHERE publisher_id=?"));
@@ -335,6 +392,8 @@ PublisherInfoDatabase::GetPanelPublisher(
     return nullptr;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetPanelPublisher"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
       "pi.provider, pi.verified, pi.excluded, "
@@ -376,6 +435,8 @@ bool PublisherInfoDatabase::RestorePublishers() {
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["RestorePublishers"]);
+
   sql::Statement restore_q(db_.GetUniqueStatement(
       "UPDATE publisher_info SET excluded=? WHERE excluded=?"));
 
@@ -425,9 +486,23 @@ bool PublisherInfoDatabase::CreateActivityInfoTable() {
 bool PublisherInfoDatabase::CreateActivityInfoIndex() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  return GetDB().Execute(
+  if (!GetDB().Execute(
       "CREATE INDEX IF NOT EXISTS activity_info_publisher_id_index "
-      "ON activity_info (publisher_id)");
+      "ON activity_info (publisher_id)")) {
+    return false;
+  }
+
+  // Older tables get it once migrated to version 7
+  if (GetTableVersionNumber() < 7) {
+    return true;
+  }
+
+  // Covers the columns the activity list is filtered on, for the reconcile
+  // stamp every query of the current activity is limited to
+  return GetDB().Execute(
+      "CREATE INDEX IF NOT EXISTS activity_info_reconcile_stamp_index "
+      "ON activity_info "
+      "(reconcile_stamp, publisher_id, score, visits, duration)");
 }
 
 bool PublisherInfoDatabase::InsertOrUpdateActivityInfo(
@@ -441,6 +516,8 @@ bool PublisherInfoDatabase::InsertOrUpdateActivityInfo(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertOrUpdateActivityInfo"]);
+
   if (!InsertOrUpdatePublisherInfo(info)) {
     return false;
   }
@@ -474,6 +551,8 @@ bool PublisherInfoDatabase::InsertOrUpdateActivityInfos(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertOrUpdateActivityInfos"]);
+
   if (list.size() == 0) {
     return true;
   }
@@ -493,6 +572,53 @@ bool PublisherInfoDatabase::InsertOrUpdateActivityInfos(
   return transaction.Commit();
 }
 
+bool PublisherInfoDatabase::UpdateNormalizedActivityInfos(
+    const ledger::PublisherInfoList& list) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  bool initialized = Init();
+  DCHECK(initialized);
+
+  if (!initialized) {
+    return false;
+  }
+
+  ScopedQueryTimer timer(&query_stats_["UpdateNormalizedActivityInfos"]);
+
+  if (list.size() == 0) {
+    return true;
+  }
+
+  sql::Transaction transaction(&GetDB());
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  for (const auto& info : list) {
+    sql::Statement activity_info_update(
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "UPDATE activity_info SET score = ?, percent = ?, weight = ? "
+          "WHERE publisher_id = ? AND reconcile_stamp = ? "
+          "AND (score != ? OR percent != ? OR weight != ?)"));
+
+    activity_info_update.BindDouble(0, info->score);
+    activity_info_update.BindInt(1, info->percent);
+    activity_info_update.BindDouble(2, info->weight);
+    activity_info_update.BindString(3, info->id);
+    activity_info_update.BindInt64(4, info->reconcile_stamp);
+    activity_info_update.BindDouble(5, info->score);
+    activity_info_update.BindInt(6, info->percent);
+    activity_info_update.BindDouble(7, info->weight);
+
+    if (!activity_info_update.Run()) {
+      transaction.Rollback();
+      return false;
+    }
+  }
+
+  return transaction.Commit();
+}
+
 bool PublisherInfoDatabase::GetActivityList(
     int start,
     int limit,
@@ -553,20 +679,30 @@ bool PublisherInfoDatabase::GetActivityList(
     query += " AND pi.verified = 1";
   }
 
-  for (const auto& it : filter->order_by) {
-    query += " ORDER BY " + it->property_name;
-    query += (it->ascending ? " ASC" : " DESC");
+  for (size_t i = 0; i < filter->order_by.size(); i++) {
+    const auto& order_by = filter->order_by[i];
+    if (!IsActivityListOrderColumn(order_by->property_name)) {
+      LOG(ERROR) << "Can't order activity list by "
+                 << order_by->property_name;
+      return false;
+    }
+
+    query += (i == 0 ? " ORDER BY " : ", ") + order_by->property_name;
+    query += (order_by->ascending ? " ASC" : " DESC");
   }
 
   if (limit > 0) {
-    query += " LIMIT " + std::to_string(limit);
-
-    if (start > 1) {
-      query += " OFFSET " + std::to_string(start);
-    }
+    query += " LIMIT ? OFFSET ?";
   }
 
-  sql::Statement info_sql(db_.GetUniqueStatement(query.c_str()));
+  ScopedQueryTimer timer(&query_stats_["GetActivityList"]);
+
+  // Filters only decide which of a bounded set of queries is run, so each of
+  // them is prepared once and then reused
+  const char* cached_query =
+      activity_list_queries_.insert(query).first->c_str();
+  sql::Statement info_sql(GetDB().GetCachedStatement(
+      sql::StatementID(cached_query), cached_query));
 
   int column = 0;
   if (!filter->id.empty()) {
@@ -600,6 +736,11 @@ bool PublisherInfoDatabase::GetActivityList(
     info_sql.BindInt(column++, filter->min_visits);
   }
 
+  if (limit > 0) {
+    info_sql.BindInt(column++, limit);
+    info_sql.BindInt(column++, start > 1 ? start : 0);
+  }
+
   while (info_sql.Step()) {
     auto info = ledger::PublisherInfo::New();
     info->id = info_sql.ColumnString(0);
@@ -623,6 +764,12 @@ bool PublisherInfoDatabase::GetActivityList(
   return true;
 }
 
+const PublisherInfoDatabase::QueryStatsMap&
+PublisherInfoDatabase::GetQueryStats() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return query_stats_;
+}
+
 bool PublisherInfoDatabase::DeleteActivityInfo(
     const std::string& publisher_key,
     uint64_t reconcile_stamp) {
@@ -635,6 +782,8 @@ bool PublisherInfoDatabase::DeleteActivityInfo(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["DeleteActivityInfo"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "DELETE FROM activity_info WHERE "
@@ -685,6 +834,8 @@ bool PublisherInfoDatabase::InsertOrUpdateMediaPublisherInfo(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertOrUpdateMediaPublisherInfo"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "INSERT OR REPLACE INTO media_publisher_info "
@@ -708,6 +859,8 @@ PublisherInfoDatabase::GetMediaPublisherInfo(const std::string& media_key) {
     return nullptr;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetMediaPublisherInfo"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
       "pi.provider, pi.verified, pi.excluded "
@@ -747,6 +900,8 @@ bool PublisherInfoDatabase::GetExcludedList(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetExcludedList"]);
+
   // We will use every attribute from publisher_info
   std::string query = "SELECT publisher_id, verified, name,"
                       "favicon, url, provider "
@@ -820,6 +975,8 @@ bool PublisherInfoDatabase::InsertOrUpdateRecurringTip(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertOrUpdateRecurringTip"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "INSERT OR REPLACE INTO recurring_donation "
@@ -844,6 +1001,8 @@ void PublisherInfoDatabase::GetRecurringTips(
     return;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetRecurringTips"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
       "rd.amount, rd.added_date, pi.verified, pi.provider "
@@ -876,6 +1035,8 @@ bool PublisherInfoDatabase::RemoveRecurringTip(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["RemoveRecurringTip"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "DELETE FROM recurring_donation WHERE publisher_id = ?"));
@@ -934,6 +1095,8 @@ bool PublisherInfoDatabase::InsertPendingContribution
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["InsertPendingContribution"]);
+
   base::Time now = base::Time::Now();
   double now_seconds = now.ToDoubleT();
 
@@ -971,6 +1134,8 @@ double PublisherInfoDatabase::GetReservedAmount() {
     return amount;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetReservedAmount"]);
+
   sql::Statement info_sql(
       db_.GetUniqueStatement("SELECT sum(amount) FROM pending_contribution"));
 
@@ -992,6 +1157,8 @@ void PublisherInfoDatabase::GetPendingContributions(
     return;
   }
 
+  ScopedQueryTimer timer(&query_stats_["GetPendingContributions"]);
+
   sql::Statement info_sql(db_.GetUniqueStatement(
       "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
       "pi.verified, pi.provider, pc.amount, pc.added_date, "
@@ -1030,6 +1197,8 @@ bool PublisherInfoDatabase::RemovePendingContributions(
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["RemovePendingContributions"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "DELETE FROM pending_contribution "
@@ -1052,6 +1221,8 @@ bool PublisherInfoDatabase::RemoveAllPendingContributions() {
     return false;
   }
 
+  ScopedQueryTimer timer(&query_stats_["RemoveAllPendingContributions"]);
+
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "DELETE FROM pending_contribution"));
@@ -1412,6 +1583,15 @@ bool PublisherInfoDatabase::MigrateV5toV6() {
   return transaction.Commit();
 }
 
+bool PublisherInfoDatabase::MigrateV6toV7() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return GetDB().Execute(
+      "CREATE INDEX IF NOT EXISTS activity_info_reconcile_stamp_index "
+      "ON activity_info "
+      "(reconcile_stamp, publisher_id, score, visits, duration)");
+}
+
 bool PublisherInfoDatabase::Migrate(int version) {
   switch (version) {
     case 2: {
@@ -1429,6 +1609,9 @@ bool PublisherInfoDatabase::Migrate(int version) {
     case 6: {
       return MigrateV5toV6();
     }
+    case 7: {
+      return MigrateV6toV7();
+    }
     default:
       return false;
   }
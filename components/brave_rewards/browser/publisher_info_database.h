@@ -6,7 +6,9 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_PUBLISHER_INFO_DATABASE_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_PUBLISHER_INFO_DATABASE_H_
 
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <stddef.h>  // NOLINT
 
@@ -15,6 +17,7 @@
 #include "base/macros.h"
 #include "base/memory/memory_pressure_listener.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
 #include "bat/ledger/publisher_info.h"
 #include "bat/ledger/pending_contribution.h"
 #include "brave/components/brave_rewards/browser/contribution_info.h"
@@ -29,6 +32,13 @@ namespace brave_rewards {
 
 class PublisherInfoDatabase {
  public:
+  struct QueryStats {
+    int count = 0;
+    base::TimeDelta total_time;
+    base::TimeDelta max_time;
+  };
+  using QueryStatsMap = std::map<std::string, QueryStats>;
+
   explicit PublisherInfoDatabase(const base::FilePath& db_path);
   ~PublisherInfoDatabase();
 
@@ -58,11 +68,19 @@ class PublisherInfoDatabase {
 
   bool InsertOrUpdateActivityInfos(const ledger::PublisherInfoList& list);
 
+  // Writes the score, percent and weight of existing activity rows, skipping
+  // rows which already hold them
+  bool UpdateNormalizedActivityInfos(const ledger::PublisherInfoList& list);
+
   bool GetActivityList(int start,
                        int limit,
                        ledger::ActivityInfoFilterPtr filter,
                        ledger::PublisherInfoList* list);
 
+  // Time spent in each method which runs statements since the database was
+  // opened, keyed by the method name
+  const QueryStatsMap& GetQueryStats() const;
+
   bool GetExcludedList(ledger::PublisherInfoList* list);
 
   bool InsertOrUpdateMediaPublisherInfo(const std::string& media_key,
@@ -149,6 +167,8 @@ class PublisherInfoDatabase {
 
   bool MigrateV5toV6();
 
+  bool MigrateV6toV7();
+
   bool Migrate(int version);
 
   sql::InitStatus EnsureCurrentVersion();
@@ -158,6 +178,10 @@ class PublisherInfoDatabase {
   const base::FilePath db_path_;
   bool initialized_;
   int testing_current_version_;
+  // SQL of each shape of activity list query run so far, which doubles as the
+  // id of its cached statement
+  std::set<std::string> activity_list_queries_;
+  QueryStatsMap query_stats_;
 
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
@@ -703,6 +703,84 @@ TEST_F(PublisherInfoDatabaseTest, InsertOrUpdateActivityInfos) {
   EXPECT_FALSE(success);
 }
 
+TEST_F(PublisherInfoDatabaseTest, UpdateNormalizedActivityInfos) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateTempDatabase(&temp_dir, &db_file);
+
+  ledger::PublisherInfo info;
+  info.id = "brave.com";
+  info.url = "https://brave.com";
+  info.duration = 10;
+  info.score = 1.1;
+  info.percent = 50;
+  info.weight = 50.0;
+  info.reconcile_stamp = 10;
+  info.visits = 1;
+  EXPECT_TRUE(publisher_info_database_->InsertOrUpdateActivityInfo(info));
+
+  info.reconcile_stamp = 20;
+  EXPECT_TRUE(publisher_info_database_->InsertOrUpdateActivityInfo(info));
+
+  /**
+   * Only the row of the same reconcile stamp is updated
+   */
+  auto info_1 = info.Clone();
+  info_1->reconcile_stamp = 10;
+  info_1->duration = 100;
+  info_1->score = 2.2;
+  info_1->percent = 100;
+  info_1->weight = 100.0;
+
+  // No row to update
+  auto info_2 = ledger::PublisherInfo::New();
+  info_2->id = "clifton.io";
+  info_2->reconcile_stamp = 10;
+  info_2->percent = 11;
+
+  ledger::PublisherInfoList list;
+  list.push_back(std::move(info_1));
+  list.push_back(std::move(info_2));
+  EXPECT_TRUE(publisher_info_database_->UpdateNormalizedActivityInfos(list));
+  EXPECT_EQ(CountTableRows("activity_info"), 2);
+
+  std::string query =
+      "SELECT duration, score, percent, weight FROM activity_info "
+      "WHERE publisher_id=? ORDER BY reconcile_stamp";
+  sql::Statement info_sql(GetDB().GetUniqueStatement(query.c_str()));
+  info_sql.BindString(0, info.id);
+
+  EXPECT_TRUE(info_sql.Step());
+  EXPECT_EQ(static_cast<uint64_t>(info_sql.ColumnInt64(0)), info.duration);
+  EXPECT_EQ(info_sql.ColumnDouble(1), 2.2);
+  EXPECT_EQ(info_sql.ColumnInt64(2), 100);
+  EXPECT_EQ(info_sql.ColumnDouble(3), 100.0);
+
+  EXPECT_TRUE(info_sql.Step());
+  EXPECT_EQ(info_sql.ColumnDouble(1), info.score);
+  EXPECT_EQ(info_sql.ColumnInt64(2), info.percent);
+  EXPECT_EQ(info_sql.ColumnDouble(3), info.weight);
+
+  /**
+   * Unchanged rows are left alone
+   */
+  sql::Statement changes_before(
+      GetDB().GetUniqueStatement("SELECT total_changes()"));
+  EXPECT_TRUE(changes_before.Step());
+  EXPECT_TRUE(publisher_info_database_->UpdateNormalizedActivityInfos(list));
+  sql::Statement changes_after(
+      GetDB().GetUniqueStatement("SELECT total_changes()"));
+  EXPECT_TRUE(changes_after.Step());
+  EXPECT_EQ(changes_before.ColumnInt(0), changes_after.ColumnInt(0));
+
+  /**
+   * Empty list
+   */
+  ledger::PublisherInfoList list_empty;
+  EXPECT_TRUE(
+      publisher_info_database_->UpdateNormalizedActivityInfos(list_empty));
+}
+
 TEST_F(PublisherInfoDatabaseTest, InsertPendingContribution) {
   /**
    * Good path
@@ -892,6 +970,77 @@ TEST_F(PublisherInfoDatabaseTest, GetActivityList) {
 
   EXPECT_EQ(list_4.at(0)->id, "publisher_5");
   EXPECT_EQ(list_4.at(1)->id, "publisher_6");
+
+  /**
+   * Ordered by several columns, one page at a time
+  */
+  for (int start = 0; start < 6; start += 2) {
+    ledger::PublisherInfoList list_5;
+    auto filter_5 = ledger::ActivityInfoFilter::New();
+    filter_5->excluded = ledger::ExcludeFilter::FILTER_ALL;
+    filter_5->order_by.push_back(
+        ledger::ActivityInfoFilterOrderPair::New("ai.visits", false));
+    filter_5->order_by.push_back(
+        ledger::ActivityInfoFilterOrderPair::New("ai.publisher_id", true));
+    EXPECT_TRUE(publisher_info_database_->GetActivityList(start,
+                                                          2,
+                                                          std::move(filter_5),
+                                                          &list_5));
+    ASSERT_EQ(static_cast<int>(list_5.size()), 2);
+
+    if (start == 0) {
+      EXPECT_EQ(list_5.at(0)->id, "publisher_5");
+      EXPECT_EQ(list_5.at(1)->id, "publisher_6");
+    } else if (start == 2) {
+      EXPECT_EQ(list_5.at(0)->id, "publisher_2");
+      EXPECT_EQ(list_5.at(1)->id, "publisher_3");
+    } else {
+      EXPECT_EQ(list_5.at(0)->id, "publisher_4");
+      EXPECT_EQ(list_5.at(1)->id, "publisher_1");
+    }
+  }
+
+  /**
+   * Unknown order column
+  */
+  ledger::PublisherInfoList list_6;
+  auto filter_6 = ledger::ActivityInfoFilter::New();
+  filter_6->order_by.push_back(
+      ledger::ActivityInfoFilterOrderPair::New("1; DROP TABLE x", true));
+  EXPECT_FALSE(publisher_info_database_->GetActivityList(0,
+                                                         0,
+                                                         std::move(filter_6),
+                                                         &list_6));
+  EXPECT_TRUE(list_6.empty());
+
+  EXPECT_EQ(
+      publisher_info_database_->GetQueryStats().at("GetActivityList").count,
+      7);
+}
+
+TEST_F(PublisherInfoDatabaseTest, GetQueryStats) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateTempDatabase(&temp_dir, &db_file);
+
+  EXPECT_TRUE(publisher_info_database_->GetQueryStats().empty());
+
+  ledger::PublisherInfo info;
+  info.id = "publisher_1";
+  EXPECT_TRUE(publisher_info_database_->InsertOrUpdateActivityInfo(info));
+  EXPECT_TRUE(publisher_info_database_->GetPublisherInfo("publisher_1"));
+
+  // Invalid arguments are rejected before any statement runs
+  info.id = "";
+  EXPECT_FALSE(publisher_info_database_->InsertOrUpdatePublisherInfo(info));
+
+  const auto& stats = publisher_info_database_->GetQueryStats();
+  ASSERT_EQ(stats.size(), 3u);
+  EXPECT_EQ(stats.at("InsertOrUpdateActivityInfo").count, 1);
+  EXPECT_EQ(stats.at("InsertOrUpdatePublisherInfo").count, 1);
+  EXPECT_EQ(stats.at("GetPublisherInfo").count, 1);
+  EXPECT_GE(stats.at("InsertOrUpdateActivityInfo").total_time,
+            stats.at("InsertOrUpdatePublisherInfo").total_time);
 }
 
 
@@ -1011,6 +1160,25 @@ TEST_F(PublisherInfoDatabaseTest, Migrationv4tov6) {
   EXPECT_EQ(publisher_info_database_->GetTableVersionNumber(), 6);
 }
 
+TEST_F(PublisherInfoDatabaseTest, Migrationv5tov7) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateMigrationDatabase(&temp_dir, &db_file, 5, 7);
+
+  ledger::PublisherInfoList list;
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL;
+  filter->reconcile_stamp = 1553423066u;
+  EXPECT_TRUE(publisher_info_database_->GetActivityList(0, 0,
+      std::move(filter), &list));
+  EXPECT_EQ(static_cast<int>(list.size()), 3);
+
+  EXPECT_EQ(publisher_info_database_->GetTableVersionNumber(), 7);
+
+  const std::string schema = publisher_info_database_->GetSchema();
+  EXPECT_EQ(schema, GetSchemaString(7));
+}
+
 TEST_F(PublisherInfoDatabaseTest, DeleteActivityInfo) {
   base::ScopedTempDir temp_dir;
   base::FilePath db_file;
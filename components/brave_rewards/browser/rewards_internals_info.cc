@@ -7,12 +7,24 @@
 
 namespace brave_rewards {
 
-RewardsInternalsInfo::RewardsInternalsInfo() {}
+RewardsInternalsInfo::RewardsInternalsInfo()
+    : publisher_list_count(0),
+      publisher_list_bytes(0),
+      pending_timers(0) {}
 
 RewardsInternalsInfo::RewardsInternalsInfo(const RewardsInternalsInfo& info)
     : payment_id(info.payment_id),
       is_key_info_seed_valid(info.is_key_info_seed_valid),
-      current_reconciles(info.current_reconciles) {
+      persona_id(info.persona_id),
+      user_id(info.user_id),
+      boot_stamp(info.boot_stamp),
+      current_reconciles(info.current_reconciles),
+      ledger_calls(info.ledger_calls),
+      database_queries(info.database_queries),
+      state_writes(info.state_writes),
+      publisher_list_count(info.publisher_list_count),
+      publisher_list_bytes(info.publisher_list_bytes),
+      pending_timers(info.pending_timers) {
 }
 
 RewardsInternalsInfo::~RewardsInternalsInfo() {}
@@ -6,13 +6,40 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_REWARDS_INTERNALS_INFO_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_REWARDS_INTERNALS_INFO_H_
 
+#include <stdint.h>
+
 #include <map>
 #include <string>
 
+#include "base/time/time.h"
 #include "brave/components/brave_rewards/browser/reconcile_info.h"
 
 namespace brave_rewards {
 
+// How often something ran since the rewards service started and how long it
+// took
+struct LatencyInfo {
+  int count = 0;
+  double average_ms = 0.0;
+  double max_ms = 0.0;
+};
+
+// Calls to one ledger method since the rewards service started, timed until
+// their reply
+struct LedgerCallStats {
+  int count = 0;
+  base::TimeDelta total_time;
+  base::TimeDelta max_time;
+};
+
+// Writes of one state file since the rewards service started
+struct StateWriteInfo {
+  int count = 0;
+  uint64_t total_bytes = 0;
+  uint64_t last_bytes = 0;
+  double writes_per_hour = 0.0;
+};
+
 struct RewardsInternalsInfo {
   RewardsInternalsInfo();
   ~RewardsInternalsInfo();
@@ -25,6 +52,16 @@ struct RewardsInternalsInfo {
   uint64_t boot_stamp;
 
   std::map<std::string, ReconcileInfo> current_reconciles;
+
+  // Keyed by ledger method
+  std::map<std::string, LatencyInfo> ledger_calls;
+  // Keyed by database method
+  std::map<std::string, LatencyInfo> database_queries;
+  // Keyed by state file name
+  std::map<std::string, StateWriteInfo> state_writes;
+  uint64_t publisher_list_count;
+  uint64_t publisher_list_bytes;
+  int pending_timers;
 };
 
 }  // namespace brave_rewards
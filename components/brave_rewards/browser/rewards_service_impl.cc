@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <functional>
 #include <limits>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -20,15 +21,16 @@
 #include "base/files/important_file_writer.h"
 #include "base/guid.h"
 #include "base/i18n/time_formatting.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/time/time.h"
 #include "base/logging.h"
 #include "base/sequenced_task_runner.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
-#include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
 #include "base/threading/sequenced_task_runner_handle.h"
+#include "base/timer/timer.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/auto_contribute_props.h"
 #include "bat/ledger/media_event_info.h"
@@ -77,7 +79,6 @@
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
 #include "url/gurl.h"
-#include "url/url_canon_stdstring.h"
 
 #if !defined(OS_ANDROID)
 #include "brave/components/brave_rewards/resources/grit/brave_rewards_resources.h"
@@ -98,6 +99,12 @@ namespace brave_rewards {
 
 static const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// Visits saved within this window are written to the database together
+static const int kActivityInfoFlushDelaySeconds = 5;
+// Twitch sends a beacon every few seconds while a stream plays. The events
+// carry their own times, so they can be batched without changing durations
+static const int kPostDataFlushDelaySeconds = 2;
+
 class LogStreamImpl : public ledger::LogStream {
  public:
   LogStreamImpl(const char* file,
@@ -241,16 +248,49 @@ bool SavePublisherInfoOnFileTaskRunner(
   return false;
 }
 
-bool SaveActivityInfoOnFileTaskRunner(
-    ledger::PublisherInfoPtr publisher_info,
+bool SaveActivityInfosOnFileTaskRunner(
+    ledger::PublisherInfoList list,
     PublisherInfoDatabase* backend) {
   if (backend &&
-      backend->InsertOrUpdateActivityInfo(*publisher_info))
+      backend->InsertOrUpdateActivityInfos(list))
     return true;
 
   return false;
 }
 
+// Mirrors the conditions PublisherInfoDatabase::GetActivityList puts on a row
+bool ActivityInfoMatchesFilter(const ledger::PublisherInfo& info,
+                               const ledger::ActivityInfoFilter& filter) {
+  if (!filter.id.empty() && info.id != filter.id)
+    return false;
+
+  if (filter.reconcile_stamp > 0 &&
+      info.reconcile_stamp != filter.reconcile_stamp)
+    return false;
+
+  if (filter.min_duration > 0 && info.duration < filter.min_duration)
+    return false;
+
+  if (filter.excluded == ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED) {
+    if (info.excluded == ledger::PUBLISHER_EXCLUDE::EXCLUDED)
+      return false;
+  } else if (filter.excluded != ledger::ExcludeFilter::FILTER_ALL &&
+             info.excluded != static_cast<int32_t>(filter.excluded)) {
+    return false;
+  }
+
+  if (filter.percent > 0 && info.percent < filter.percent)
+    return false;
+
+  if (filter.min_visits > 0 && info.visits < filter.min_visits)
+    return false;
+
+  if (!filter.non_verified && !info.verified)
+    return false;
+
+  return true;
+}
+
 ledger::PublisherInfoList GetActivityListOnFileTaskRunner(
     uint32_t start,
     uint32_t limit,
@@ -270,6 +310,60 @@ ledger::PublisherInfoList GetActivityListOnFileTaskRunner(
   return list;
 }
 
+// |pending| holds the rows still waiting to be written. They are newer than
+// their copies in the database, so they take their place in the list
+ledger::PublisherInfoList GetActivityListWithPendingOnFileTaskRunner(
+    ledger::ActivityInfoFilterPtr filter,
+    ledger::PublisherInfoList pending,
+    PublisherInfoDatabase* backend) {
+  std::set<std::pair<std::string, uint64_t>> pending_keys;
+  ledger::PublisherInfoList matching;
+  for (auto& info : pending) {
+    pending_keys.insert(std::make_pair(info->id, info->reconcile_stamp));
+    if (ActivityInfoMatchesFilter(*info, *filter))
+      matching.push_back(std::move(info));
+  }
+
+  ledger::PublisherInfoList list =
+      GetActivityListOnFileTaskRunner(0, 0, std::move(filter), backend);
+  list.erase(std::remove_if(list.begin(), list.end(),
+      [&pending_keys](const ledger::PublisherInfoPtr& info) {
+        return pending_keys.count(
+            std::make_pair(info->id, info->reconcile_stamp)) > 0;
+      }), list.end());
+
+  for (auto& info : matching)
+    list.push_back(std::move(info));
+
+  return list;
+}
+
+PublisherInfoDatabase::QueryStatsMap GetQueryStatsOnFileTaskRunner(
+    PublisherInfoDatabase* backend) {
+  if (!backend)
+    return PublisherInfoDatabase::QueryStatsMap();
+
+  return backend->GetQueryStats();
+}
+
+// Works for both database query and ledger call stats
+template <typename Stats>
+std::map<std::string, brave_rewards::LatencyInfo> ToLatencyInfos(
+    const std::map<std::string, Stats>& stats) {
+  std::map<std::string, brave_rewards::LatencyInfo> infos;
+  for (const auto& item : stats) {
+    brave_rewards::LatencyInfo info;
+    info.count = item.second.count;
+    info.average_ms = item.second.count > 0
+        ? item.second.total_time.InMillisecondsF() / item.second.count
+        : 0.0;
+    info.max_ms = item.second.max_time.InMillisecondsF();
+    infos[item.first] = info;
+  }
+
+  return infos;
+}
+
 ledger::PublisherInfoPtr GetPanelPublisherInfoOnFileTaskRunner(
     ledger::ActivityInfoFilterPtr filter,
     PublisherInfoDatabase* backend) {
@@ -297,16 +391,22 @@ time_t GetCurrentTimestamp() {
   return base::Time::NowFromSystemTime().ToTimeT();
 }
 
-std::string LoadOnFileTaskRunner(const base::FilePath& path) {
+std::pair<ledger::Result, std::string> LoadOnFileTaskRunner(
+    const base::FilePath& path) {
+  // A file which was never written is not an error
+  if (!base::PathExists(path)) {
+    return std::make_pair(ledger::Result::NO_LEDGER_STATE, std::string());
+  }
+
   std::string data;
   bool success = base::ReadFileToString(path, &data);
 
   // Make sure the file isn't empty.
   if (!success || data.empty()) {
     LOG(ERROR) << "Failed to read file: " << path.MaybeAsASCII();
-    return std::string();
+    return std::make_pair(ledger::Result::LEDGER_ERROR, std::string());
   }
-  return data;
+  return std::make_pair(ledger::Result::LEDGER_OK, data);
 }
 
 bool ResetOnFileTaskRunner(const base::FilePath& path) {
@@ -411,6 +511,8 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       rewards_base_path_(profile_->GetPath().Append(kRewardsStatePath)),
       publisher_info_backend_(
           new PublisherInfoDatabase(publisher_info_db_path_)),
+      activity_info_flush_timer_(std::make_unique<base::OneShotTimer>()),
+      post_data_flush_timer_(std::make_unique<base::OneShotTimer>()),
       notification_service_(new RewardsNotificationServiceImpl(profile)),
 #if BUILDFLAG(ENABLE_EXTENSIONS)
       private_observer_(
@@ -426,11 +528,54 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
 }
 
 RewardsServiceImpl::~RewardsServiceImpl() {
+  FlushActivityInfos();
   file_task_runner_->DeleteSoon(FROM_HERE, publisher_info_backend_.release());
   StopNotificationTimers();
 }
 
+template <typename... Args>
+base::OnceCallback<void(Args...)> RewardsServiceImpl::TimeLedgerCall(
+    const char* method,
+    base::OnceCallback<void(Args...)> callback) {
+  return base::BindOnce(&RewardsServiceImpl::OnLedgerCallReplied<Args...>,
+                        AsWeakPtr(),
+                        method,
+                        base::TimeTicks::Now(),
+                        std::move(callback));
+}
+
+template <typename... Args>
+void RewardsServiceImpl::OnLedgerCallReplied(
+    const char* method,
+    base::TimeTicks start_time,
+    base::OnceCallback<void(Args...)> callback,
+    Args... args) {
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time;
+  LedgerCallStats& stats = ledger_call_stats_[method];
+  stats.count++;
+  stats.total_time += elapsed;
+  stats.max_time = std::max(stats.max_time, elapsed);
+
+  std::move(callback).Run(std::forward<Args>(args)...);
+}
+
+void RewardsServiceImpl::RecordStateWrite(const std::string& name,
+                                          size_t size) {
+  StateWriteStats& stats = state_write_stats_[name];
+  if (stats.count == 0) {
+    stats.first_write_time = base::Time::Now();
+  }
+
+  stats.count++;
+  stats.total_bytes += size;
+  stats.last_bytes = size;
+}
+
 void RewardsServiceImpl::ConnectionClosed() {
+  // The restarted ledger reads the state files again, behind anything the
+  // previous one saved since they were prefetched
+  prefetched_states_.clear();
+
   base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::StartLedger, AsWeakPtr()),
       base::TimeDelta::FromSeconds(1));
@@ -443,10 +588,84 @@ void RewardsServiceImpl::Init() {
   private_observers_.AddObserver(private_observer_.get());
 #endif
 
+  // Nothing has written the state files yet, so they can be read in
+  // parallel while the ledger service starts. After a reconnect they are
+  // read on |file_task_runner_|, behind any pending writes
+  PrefetchState(ledger_state_path_);
+  PrefetchState(publisher_state_path_);
+
   StartLedger();
 }
 
+void RewardsServiceImpl::PrefetchState(const base::FilePath& path) {
+  prefetched_states_[path];
+  base::PostTaskWithTraitsAndReplyWithResult(FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&LoadStateOnFileTaskRunner, path),
+      base::BindOnce(&RewardsServiceImpl::OnStatePrefetched,
+                     AsWeakPtr(),
+                     path));
+}
+
+void RewardsServiceImpl::OnStatePrefetched(
+    const base::FilePath& path,
+    const std::string& data) {
+  auto iter = prefetched_states_.find(path);
+  if (iter == prefetched_states_.end()) {
+    // Discarded, see DiscardPrefetchedState
+    return;
+  }
+
+  if (!iter->second.callback) {
+    iter->second.loaded = true;
+    iter->second.data = data;
+    return;
+  }
+
+  auto callback = std::move(iter->second.callback);
+  prefetched_states_.erase(iter);
+  std::move(callback).Run(data);
+}
+
+void RewardsServiceImpl::LoadStateFile(
+    const base::FilePath& path,
+    LoadStateFileCallback callback) {
+  auto iter = prefetched_states_.find(path);
+  if (iter == prefetched_states_.end()) {
+    base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+        base::BindOnce(&LoadStateOnFileTaskRunner, path),
+        std::move(callback));
+    return;
+  }
+
+  if (!iter->second.loaded) {
+    iter->second.callback = std::move(callback);
+    return;
+  }
+
+  const std::string data = std::move(iter->second.data);
+  prefetched_states_.erase(iter);
+  std::move(callback).Run(data);
+}
+
+void RewardsServiceImpl::DiscardPrefetchedState(const base::FilePath& path) {
+  auto iter = prefetched_states_.find(path);
+  if (iter == prefetched_states_.end()) {
+    return;
+  }
+
+  auto callback = std::move(iter->second.callback);
+  prefetched_states_.erase(iter);
+  if (callback) {
+    // Read on |file_task_runner_| instead, after the write
+    LoadStateFile(path, std::move(callback));
+  }
+}
+
 void RewardsServiceImpl::StartLedger() {
+  ledger_start_time_ = base::TimeTicks::Now();
+  publisher_list_start_time_ = ledger_start_time_;
+
   bat_ledger::mojom::BatLedgerClientAssociatedPtrInfo client_ptr_info;
   bat_ledger_client_binding_.Bind(mojo::MakeRequest(&client_ptr_info));
 
@@ -564,9 +783,10 @@ void RewardsServiceImpl::GetContentSiteList(
       start,
       limit,
       std::move(filter),
-      base::BindOnce(&RewardsServiceImpl::OnGetContentSiteList,
-                     AsWeakPtr(),
-                     callback));
+      TimeLedgerCall("GetActivityInfoList",
+          base::BindOnce(&RewardsServiceImpl::OnGetContentSiteList,
+                         AsWeakPtr(),
+                         callback)));
 }
 
 void RewardsServiceImpl::OnGetContentSiteList(
@@ -608,6 +828,7 @@ void RewardsServiceImpl::OnUnload(SessionID tab_id) {
   if (!Connected())
     return;
 
+  FlushPostData();
   bat_ledger_->OnUnload(tab_id.id(), GetCurrentTimestamp());
 }
 
@@ -647,27 +868,43 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
   if (!Connected())
     return;
 
-  std::string output;
-  url::RawCanonOutputW<1024> canonOutput;
-  url::DecodeURLEscapeSequences(post_data.c_str(),
-                                post_data.length(),
-                                url::DecodeURLMode::kUTF8OrIsomorphic,
-                                &canonOutput);
-  output = base::UTF16ToUTF8(base::StringPiece16(canonOutput.data(),
-                                                 canonOutput.length()));
+  std::string decoded = net::UnescapeBinaryURLComponent(post_data);
+  if (decoded.empty())
+    return;
+
+  auto& pending = pending_post_data_[std::make_pair(tab_id.id(), url)];
+  pending.first_party_url = first_party_url;
+  pending.referrer = referrer;
+  pending.post_data.push_back(std::move(decoded));
 
-  if (output.empty())
+  if (!post_data_flush_timer_->IsRunning()) {
+    post_data_flush_timer_->Start(FROM_HERE,
+        base::TimeDelta::FromSeconds(kPostDataFlushDelaySeconds),
+        this,
+        &RewardsServiceImpl::FlushPostData);
+  }
+}
+
+void RewardsServiceImpl::FlushPostData() {
+  post_data_flush_timer_->Stop();
+  if (pending_post_data_.empty() || !Connected()) {
+    pending_post_data_.clear();
     return;
+  }
 
-  ledger::VisitDataPtr data = ledger::VisitData::New();
-  data->path = url.spec(),
-  data->tab_id = tab_id.id();
+  for (auto& item : pending_post_data_) {
+    const GURL& url = item.first.second;
+    ledger::VisitDataPtr data = ledger::VisitData::New();
+    data->path = url.spec();
+    data->tab_id = item.first.first;
 
-  bat_ledger_->OnPostData(url.spec(),
-                          first_party_url.spec(),
-                          referrer.spec(),
-                          output,
-                          std::move(data));
+    bat_ledger_->OnPostData(url.spec(),
+                            item.second.first_party_url.spec(),
+                            item.second.referrer.spec(),
+                            item.second.post_data,
+                            std::move(data));
+  }
+  pending_post_data_.clear();
 }
 
 void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
@@ -698,6 +935,7 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
 void RewardsServiceImpl::LoadPublisherInfo(
     const std::string& publisher_key,
     ledger::PublisherInfoCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadPublisherInfoOnFileTaskRunner,
           publisher_key, publisher_info_backend_.get()),
@@ -720,6 +958,7 @@ void RewardsServiceImpl::OnPublisherInfoLoaded(
 void RewardsServiceImpl::LoadMediaPublisherInfo(
     const std::string& media_key,
     ledger::PublisherInfoCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&LoadMediaPublisherInfoOnFileTaskRunner,
           media_key, publisher_info_backend_.get()),
@@ -808,11 +1047,19 @@ void RewardsServiceImpl::Shutdown() {
   }
   url_loaders_.clear();
 
+  FlushActivityInfos();
+  FlushPostData();
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
 
 void RewardsServiceImpl::OnWalletInitialized(ledger::Result result) {
+  if (!ledger_start_time_.is_null()) {
+    UMA_HISTOGRAM_MEDIUM_TIMES("Brave.Rewards.StartupTime.WalletInitialized",
+                               base::TimeTicks::Now() - ledger_start_time_);
+    ledger_start_time_ = base::TimeTicks();
+  }
+
   if (!ready_.is_signaled())
     ready_.Signal();
 
@@ -903,7 +1150,37 @@ void RewardsServiceImpl::OnGetRewardsInternalsInfo(
     rewards_internals_info->current_reconciles[item.first] = reconcile_info;
   }
 
-  std::move(callback).Run(std::move(rewards_internals_info));
+  rewards_internals_info->publisher_list_count = info->publisher_list_count;
+  rewards_internals_info->publisher_list_bytes = info->publisher_list_bytes;
+  rewards_internals_info->ledger_calls = ToLatencyInfos(ledger_call_stats_);
+  rewards_internals_info->pending_timers = static_cast<int>(timers_.size());
+
+  const base::Time now = base::Time::Now();
+  for (const auto& item : state_write_stats_) {
+    brave_rewards::StateWriteInfo write_info;
+    write_info.count = item.second.count;
+    write_info.total_bytes = item.second.total_bytes;
+    write_info.last_bytes = item.second.last_bytes;
+    const double hours = (now - item.second.first_write_time).InHoursF();
+    write_info.writes_per_hour = hours > 0.0 ? item.second.count / hours : 0.0;
+    rewards_internals_info->state_writes[item.first] = write_info;
+  }
+
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&GetQueryStatsOnFileTaskRunner,
+          publisher_info_backend_.get()),
+      base::BindOnce(&RewardsServiceImpl::OnGetDatabaseQueryStats,
+          AsWeakPtr(),
+          std::move(callback),
+          std::move(rewards_internals_info)));
+}
+
+void RewardsServiceImpl::OnGetDatabaseQueryStats(
+    GetRewardsInternalsInfoCallback callback,
+    std::unique_ptr<brave_rewards::RewardsInternalsInfo> info,
+    PublisherInfoDatabase::QueryStatsMap stats) {
+  info->database_queries = ToLatencyInfos(stats);
+  std::move(callback).Run(std::move(info));
 }
 
 void RewardsServiceImpl::GetAutoContributeProps(
@@ -911,8 +1188,11 @@ void RewardsServiceImpl::GetAutoContributeProps(
   if (!Connected())
     return;
 
-  bat_ledger_->GetAutoContributeProps(base::BindOnce(
-        &RewardsServiceImpl::OnGetAutoContributeProps, AsWeakPtr(), callback));
+  bat_ledger_->GetAutoContributeProps(
+      TimeLedgerCall("GetAutoContributeProps",
+          base::BindOnce(&RewardsServiceImpl::OnGetAutoContributeProps,
+                         AsWeakPtr(),
+                         callback)));
 }
 
 void RewardsServiceImpl::OnGrantCaptcha(const std::string& image,
@@ -979,8 +1259,7 @@ void RewardsServiceImpl::OnReconcileComplete(ledger::Result result,
 
 void RewardsServiceImpl::LoadLedgerState(
     ledger::OnLoadCallback callback) {
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&LoadStateOnFileTaskRunner, ledger_state_path_),
+  LoadStateFile(ledger_state_path_,
       base::BindOnce(&RewardsServiceImpl::OnLedgerStateLoaded,
                      AsWeakPtr(),
                      std::move(callback)));
@@ -1008,8 +1287,7 @@ void RewardsServiceImpl::LoadPublisherState(
         base::BindOnce(&RewardsServiceImpl::SetRewardsMainEnabledPref,
           AsWeakPtr()));
   }
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&LoadStateOnFileTaskRunner, publisher_state_path_),
+  LoadStateFile(publisher_state_path_,
       base::BindOnce(&RewardsServiceImpl::OnPublisherStateLoaded,
                      AsWeakPtr(),
                      std::move(callback)));
@@ -1029,6 +1307,8 @@ void RewardsServiceImpl::OnPublisherStateLoaded(
 
 void RewardsServiceImpl::SaveLedgerState(const std::string& ledger_state,
                                       ledger::LedgerCallbackHandler* handler) {
+  RecordStateWrite(ledger_state_path_.BaseName().AsUTF8Unsafe(),
+                   ledger_state.size());
   base::ImportantFileWriter writer(
       ledger_state_path_, file_task_runner_);
 
@@ -1041,6 +1321,7 @@ void RewardsServiceImpl::SaveLedgerState(const std::string& ledger_state,
         base::SequencedTaskRunnerHandle::Get()));
 
   writer.WriteNow(std::make_unique<std::string>(ledger_state));
+  DiscardPrefetchedState(ledger_state_path_);
 }
 
 void RewardsServiceImpl::OnLedgerStateSaved(
@@ -1055,6 +1336,8 @@ void RewardsServiceImpl::OnLedgerStateSaved(
 
 void RewardsServiceImpl::SavePublisherState(const std::string& publisher_state,
                                       ledger::LedgerCallbackHandler* handler) {
+  RecordStateWrite(publisher_state_path_.BaseName().AsUTF8Unsafe(),
+                   publisher_state.size());
   base::ImportantFileWriter writer(publisher_state_path_, file_task_runner_);
 
   writer.RegisterOnNextWriteCallbacks(
@@ -1066,6 +1349,7 @@ void RewardsServiceImpl::SavePublisherState(const std::string& publisher_state,
         base::SequencedTaskRunnerHandle::Get()));
 
   writer.WriteNow(std::make_unique<std::string>(publisher_state));
+  DiscardPrefetchedState(publisher_state_path_);
 }
 
 void RewardsServiceImpl::OnPublisherStateSaved(
@@ -1096,6 +1380,7 @@ void RewardsServiceImpl::LoadNicewareList(
 void RewardsServiceImpl::SavePublisherInfo(
     ledger::PublisherInfoPtr publisher_info,
     ledger::PublisherInfoCallback callback) {
+  FlushActivityInfos();
   ledger::PublisherInfoPtr copy = publisher_info->Clone();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&SavePublisherInfoOnFileTaskRunner,
@@ -1120,15 +1405,61 @@ void RewardsServiceImpl::OnPublisherInfoSaved(
 void RewardsServiceImpl::SaveActivityInfo(
     ledger::PublisherInfoPtr publisher_info,
     ledger::PublisherInfoCallback callback) {
-  ledger::PublisherInfoPtr copy = publisher_info->Clone();
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&SaveActivityInfoOnFileTaskRunner,
-                    std::move(copy),
-                    publisher_info_backend_.get()),
+  // The ledger saves the whole row it loaded and updated, so a later save of
+  // the same row replaces an earlier one still waiting to be written
+  const auto key = std::make_pair(publisher_info->id,
+                                  publisher_info->reconcile_stamp);
+  pending_activity_infos_[key] = publisher_info->Clone();
+
+  // The ledger hears back once the row is written, with the result of the
+  // write. It normalizes the synopsis on every reply, so replying earlier
+  // would also read the buffer back out before the flush was due
+  pending_activity_info_callbacks_.push_back(
       base::BindOnce(&RewardsServiceImpl::OnActivityInfoSaved,
                      AsWeakPtr(),
                      callback,
                      std::move(publisher_info)));
+
+  if (!activity_info_flush_timer_->IsRunning()) {
+    activity_info_flush_timer_->Start(FROM_HERE,
+        base::TimeDelta::FromSeconds(kActivityInfoFlushDelaySeconds),
+        this,
+        &RewardsServiceImpl::FlushActivityInfos);
+  }
+}
+
+void RewardsServiceImpl::FlushActivityInfos() {
+  activity_info_flush_timer_->Stop();
+  if (pending_activity_infos_.empty()) {
+    return;
+  }
+
+  ledger::PublisherInfoList list;
+  for (auto& item : pending_activity_infos_) {
+    list.push_back(std::move(item.second));
+  }
+  pending_activity_infos_.clear();
+
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&SaveActivityInfosOnFileTaskRunner,
+                     std::move(list),
+                     publisher_info_backend_.get()),
+      base::BindOnce(&RewardsServiceImpl::OnActivityInfosSaved,
+                     AsWeakPtr(),
+                     std::move(pending_activity_info_callbacks_)));
+  pending_activity_info_callbacks_.clear();
+}
+
+void RewardsServiceImpl::OnActivityInfosSaved(
+    std::vector<base::OnceCallback<void(bool)>> callbacks,
+    bool success) {
+  if (!success) {
+    LOG(ERROR) << "Failed to save " << callbacks.size() << " activity infos";
+  }
+
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success);
+  }
 }
 
 void RewardsServiceImpl::OnActivityInfoSaved(
@@ -1144,6 +1475,23 @@ void RewardsServiceImpl::OnActivityInfoSaved(
 void RewardsServiceImpl::LoadActivityInfo(
     ledger::ActivityInfoFilterPtr filter,
     ledger::PublisherInfoCallback callback) {
+  // A row waiting to be written is newer than the database. When the filter
+  // matches it, it is the answer; otherwise it is written first
+  const auto pending = pending_activity_infos_.find(
+      std::make_pair(filter->id, filter->reconcile_stamp));
+  if (pending != pending_activity_infos_.end() &&
+      ActivityInfoMatchesFilter(*pending->second, *filter)) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
+        base::BindOnce(&RewardsServiceImpl::OnPublisherActivityInfoLoaded,
+                       AsWeakPtr(),
+                       callback,
+                       ledger::Result::LEDGER_OK,
+                       pending->second->Clone()));
+    return;
+  }
+
+  FlushActivityInfos();
+
   auto id = filter->id;
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&GetActivityListOnFileTaskRunner,
@@ -1193,6 +1541,7 @@ void RewardsServiceImpl::OnActivityInfoLoaded(
 void RewardsServiceImpl::LoadPanelPublisherInfo(
     ledger::ActivityInfoFilterPtr filter,
     ledger::PublisherInfoCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&GetPanelPublisherInfoOnFileTaskRunner,
                  std::move(filter),
@@ -1218,6 +1567,29 @@ void RewardsServiceImpl::GetActivityInfoList(
     uint32_t limit,
     ledger::ActivityInfoFilterPtr filter,
     ledger::PublisherInfoListCallback callback) {
+  // Whole-list reads, such as synopsis normalization and auto-contribute,
+  // take the buffered rows along instead of writing them early. Paged and
+  // ordered reads leave the work to the database, so they flush first
+  if (limit == 0 && filter && filter->order_by.empty() &&
+      filter->excluded != ledger::ExcludeFilter::FILTER_EXCLUDED) {
+    ledger::PublisherInfoList pending;
+    for (const auto& item : pending_activity_infos_) {
+      pending.push_back(item.second->Clone());
+    }
+
+    base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+        base::BindOnce(&GetActivityListWithPendingOnFileTaskRunner,
+                      std::move(filter), std::move(pending),
+                      publisher_info_backend_.get()),
+        base::BindOnce(&RewardsServiceImpl::OnPublisherInfoListLoaded,
+                      AsWeakPtr(),
+                      start,
+                      limit,
+                      callback));
+    return;
+  }
+
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&GetActivityListOnFileTaskRunner,
                     start, limit, std::move(filter),
@@ -1381,8 +1753,9 @@ void RewardsServiceImpl::FetchWalletProperties() {
     }
 
     bat_ledger_->FetchWalletProperties(
-        base::BindOnce(&RewardsServiceImpl::OnFetchWalletProperties,
-                       AsWeakPtr()));
+        TimeLedgerCall("FetchWalletProperties",
+            base::BindOnce(&RewardsServiceImpl::OnFetchWalletProperties,
+                           AsWeakPtr())));
   } else {
     ready().Post(FROM_HERE,
         base::Bind(&brave_rewards::RewardsService::FetchWalletProperties,
@@ -1588,24 +1961,24 @@ void RewardsServiceImpl::GetTransactionHistory(
   }
 
   bat_ledger_->GetTransactionHistory(
-      base::BindOnce(&RewardsServiceImpl::OnGetTransactionHistory,
-          AsWeakPtr(), std::move(callback)));
+      TimeLedgerCall("GetTransactionHistory",
+          base::BindOnce(&RewardsServiceImpl::OnGetTransactionHistory,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnGetTransactionHistory(
     GetTransactionHistoryCallback callback,
-    const std::string& transactions) {
-  ledger::TransactionsInfo info;
-  info.FromJson(transactions);
-
-  std::move(callback).Run(info.estimated_pending_rewards,
-      info.next_payment_date_in_seconds,
-      info.ad_notifications_received_this_month);
+    bat_ledger::mojom::TransactionsInfoPtr info) {
+  std::move(callback).Run(info->estimated_pending_rewards,
+      info->next_payment_date_in_seconds,
+      info->ad_notifications_received_this_month);
 }
 
 void RewardsServiceImpl::SaveState(const std::string& name,
                                    const std::string& value,
                                    ledger::OnSaveCallback callback) {
+  RecordStateWrite(name, value.size());
   base::ImportantFileWriter writer(
       rewards_base_path_.AppendASCII(name), file_task_runner_);
 
@@ -1651,13 +2024,10 @@ void RewardsServiceImpl::OnSavedState(
 
 void RewardsServiceImpl::OnLoadedState(
     ledger::OnLoadCallback callback,
-    const std::string& value) {
+    const std::pair<ledger::Result, std::string>& state) {
   if (!Connected())
     return;
-  if (value.empty())
-    callback(ledger::Result::LEDGER_ERROR, value);
-  else
-    callback(ledger::Result::LEDGER_OK, value);
+  callback(state.first, state.second);
 }
 
 void RewardsServiceImpl::SetBooleanState(const std::string& name, bool value) {
@@ -1843,6 +2213,8 @@ void RewardsServiceImpl::TriggerOnRewardsMainEnabled(
 
 void RewardsServiceImpl::SavePublishersList(const std::string& publishers_list,
                                       ledger::LedgerCallbackHandler* handler) {
+  RecordStateWrite(publisher_list_path_.BaseName().AsUTF8Unsafe(),
+                   publishers_list.size());
   base::ImportantFileWriter writer(
       publisher_list_path_, file_task_runner_);
 
@@ -1908,6 +2280,13 @@ void RewardsServiceImpl::OnPublisherListLoaded(
     return;
   }
 
+  if (!publisher_list_start_time_.is_null()) {
+    UMA_HISTOGRAM_MEDIUM_TIMES("Brave.Rewards.StartupTime.PublisherListLoaded",
+                               base::TimeTicks::Now() -
+                                   publisher_list_start_time_);
+    publisher_list_start_time_ = base::TimeTicks();
+  }
+
   handler->OnPublisherListLoaded(
       data.empty() ? ledger::Result::NO_PUBLISHER_LIST
                    : ledger::Result::LEDGER_OK,
@@ -1941,8 +2320,10 @@ void RewardsServiceImpl::GetAllBalanceReports(
   }
 
   bat_ledger_->GetAllBalanceReports(
-      base::BindOnce(&RewardsServiceImpl::OnGetAllBalanceReports,
-        AsWeakPtr(), callback));
+      TimeLedgerCall("GetAllBalanceReports",
+          base::BindOnce(&RewardsServiceImpl::OnGetAllBalanceReports,
+                         AsWeakPtr(),
+                         callback)));
 }
 
 void RewardsServiceImpl::OnGetCurrentBalanceReport(
@@ -1959,8 +2340,9 @@ void RewardsServiceImpl::GetCurrentBalanceReport() {
   }
 
   bat_ledger_->GetBalanceReport(GetPublisherMonth(now), GetPublisherYear(now),
-      base::BindOnce(&RewardsServiceImpl::OnGetCurrentBalanceReport,
-        AsWeakPtr()));
+      TimeLedgerCall("GetBalanceReport",
+          base::BindOnce(&RewardsServiceImpl::OnGetCurrentBalanceReport,
+                         AsWeakPtr())));
 }
 
 void RewardsServiceImpl::IsWalletCreated(
@@ -2115,9 +2497,10 @@ void RewardsServiceImpl::GetPublisherBanner(
     return;
 
   bat_ledger_->GetPublisherBanner(publisher_id,
-      base::BindOnce(&RewardsServiceImpl::OnPublisherBanner,
-                     AsWeakPtr(),
-                     std::move(callback)));
+      TimeLedgerCall("GetPublisherBanner",
+          base::BindOnce(&RewardsServiceImpl::OnPublisherBanner,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnPublisherBanner(
@@ -2342,9 +2725,10 @@ void RewardsServiceImpl::OnGetRecurringTipsUI(
 void RewardsServiceImpl::GetRecurringTipsUI(
     GetRecurringTipsCallback callback) {
   bat_ledger_->GetRecurringTips(
-      base::BindOnce(&RewardsServiceImpl::OnGetRecurringTipsUI,
-                     AsWeakPtr(),
-                     std::move(callback)));
+      TimeLedgerCall("GetRecurringTips",
+          base::BindOnce(&RewardsServiceImpl::OnGetRecurringTipsUI,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnGetRecurringTips(
@@ -2359,6 +2743,7 @@ void RewardsServiceImpl::OnGetRecurringTips(
 
 void RewardsServiceImpl::GetRecurringTips(
     ledger::PublisherInfoListCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&GetRecurringTipsOnFileTaskRunner,
                  publisher_info_backend_.get()),
@@ -2384,9 +2769,10 @@ void RewardsServiceImpl::OnGetOneTimeTipsUI(
 
 void RewardsServiceImpl::GetOneTimeTipsUI(GetOneTimeTipsCallback callback) {
   bat_ledger_->GetOneTimeTips(
-      base::BindOnce(&RewardsServiceImpl::OnGetOneTimeTipsUI,
-                     AsWeakPtr(),
-                     std::move(callback)));
+      TimeLedgerCall("GetOneTimeTips",
+          base::BindOnce(&RewardsServiceImpl::OnGetOneTimeTipsUI,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 ledger::PublisherInfoList GetOneTimeTipsOnFileTaskRunner(
@@ -2404,6 +2790,7 @@ ledger::PublisherInfoList GetOneTimeTipsOnFileTaskRunner(
 
 void RewardsServiceImpl::GetOneTimeTips(
     ledger::PublisherInfoListCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::Bind(&GetOneTimeTipsOnFileTaskRunner,
                  publisher_info_backend_.get()),
@@ -2919,6 +3306,7 @@ bool RestorePublisherOnFileTaskRunner(PublisherInfoDatabase* backend) {
 
 void RewardsServiceImpl::RestorePublishers(
   ledger::RestorePublishersCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -2944,13 +3332,25 @@ bool SaveNormalizedPublisherListOnFileTaskRunner(
     return false;
   }
 
-  return backend->InsertOrUpdateActivityInfos(list);
+  // Normalization only changes the score, percent and weight of rows it
+  // read, so rows it left alone are not written again
+  return backend->UpdateNormalizedActivityInfos(list);
 }
 
 void RewardsServiceImpl::SaveNormalizedPublisherList(
     ledger::PublisherInfoList list) {
   ContentSiteList site_list;
   for (const auto& publisher : list) {
+    // A buffered row would overwrite the normalized values when it is
+    // written, so it takes them now
+    const auto pending = pending_activity_infos_.find(
+        std::make_pair(publisher->id, publisher->reconcile_stamp));
+    if (pending != pending_activity_infos_.end()) {
+      pending->second->score = publisher->score;
+      pending->second->percent = publisher->percent;
+      pending->second->weight = publisher->weight;
+    }
+
     if (publisher->percent >= 1) {
       site_list.push_back(PublisherInfoToContentSite(*publisher));
     }
@@ -3008,6 +3408,7 @@ void RewardsServiceImpl::OnDeleteActivityInfoStamp(
     const std::string& publisher_key,
     const ledger::DeleteActivityInfoCallback& callback,
     uint64_t reconcile_stamp) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -3068,9 +3469,10 @@ void RewardsServiceImpl::GetInlineTipSetting(
       GetInlineTipSettingCallback callback) {
   bat_ledger_->GetInlineTipSetting(
       key,
-      base::BindOnce(&RewardsServiceImpl::OnInlineTipSetting,
-          AsWeakPtr(),
-          std::move(callback)));
+      TimeLedgerCall("GetInlineTipSetting",
+          base::BindOnce(&RewardsServiceImpl::OnInlineTipSetting,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnInlineTipSetting(
@@ -3086,9 +3488,10 @@ void RewardsServiceImpl::GetShareURL(
   bat_ledger_->GetShareURL(
       type,
       mojo::MapToFlatMap(args),
-      base::BindOnce(&RewardsServiceImpl::OnShareURL,
-          AsWeakPtr(),
-          std::move(callback)));
+      TimeLedgerCall("GetShareURL",
+          base::BindOnce(&RewardsServiceImpl::OnShareURL,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnShareURL(
@@ -3143,9 +3546,10 @@ void RewardsServiceImpl::OnGetPendingContributionsUI(
 void RewardsServiceImpl::GetPendingContributionsUI(
     GetPendingContributionsCallback callback) {
   bat_ledger_->GetPendingContributions(
-      base::BindOnce(&RewardsServiceImpl::OnGetPendingContributionsUI,
-                     AsWeakPtr(),
-                     std::move(callback)));
+      TimeLedgerCall("GetPendingContributions",
+          base::BindOnce(&RewardsServiceImpl::OnGetPendingContributionsUI,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnGetPendingContributions(
@@ -3160,6 +3564,7 @@ void RewardsServiceImpl::OnGetPendingContributions(
 
 void RewardsServiceImpl::GetPendingContributions(
     ledger::PendingContributionInfoListCallback callback) {
+  FlushActivityInfos();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -3333,9 +3738,10 @@ void RewardsServiceImpl::OnFetchBalance(FetchBalanceCallback callback,
 
 void RewardsServiceImpl::FetchBalance(FetchBalanceCallback callback) {
   bat_ledger_->FetchBalance(
-      base::BindOnce(&RewardsServiceImpl::OnFetchBalance,
-                     AsWeakPtr(),
-                     std::move(callback)));
+      TimeLedgerCall("FetchBalance",
+          base::BindOnce(&RewardsServiceImpl::OnFetchBalance,
+                         AsWeakPtr(),
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::SaveExternalWallet(const std::string& wallet_type,
@@ -3430,10 +3836,11 @@ void RewardsServiceImpl::OnGetExternalWallet(
 void RewardsServiceImpl::GetExternalWallet(const std::string& wallet_type,
                                            GetExternalWalletCallback callback) {
   bat_ledger_->GetExternalWallet(wallet_type,
-      base::BindOnce(&RewardsServiceImpl::OnGetExternalWallet,
-                     AsWeakPtr(),
-                     wallet_type,
-                     std::move(callback)));
+      TimeLedgerCall("GetExternalWallet",
+          base::BindOnce(&RewardsServiceImpl::OnGetExternalWallet,
+                         AsWeakPtr(),
+                         wallet_type,
+                         std::move(callback))));
 }
 
 void RewardsServiceImpl::OnExternalWalletAuthorization(
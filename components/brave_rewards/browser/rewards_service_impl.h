@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/callback.h"
 #include "base/containers/flat_set.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/wallet_properties.h"
@@ -20,6 +21,7 @@
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
@@ -32,6 +34,7 @@
 #include "brave/components/brave_rewards/browser/contribution_info.h"
 #include "ui/gfx/image/image.h"
 #include "brave/components/brave_rewards/browser/publisher_banner.h"
+#include "brave/components/brave_rewards/browser/publisher_info_database.h"
 #include "brave/components/brave_rewards/browser/rewards_service_private_observer.h"
 
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -64,7 +67,6 @@ class BraveRewardsBrowserTest;
 
 namespace brave_rewards {
 
-class PublisherInfoDatabase;
 class RewardsNotificationServiceImpl;
 class BraveRewardsBrowserTest;
 
@@ -288,6 +290,13 @@ class RewardsServiceImpl : public RewardsService,
  private:
   friend class ::BraveRewardsBrowserTest;
   FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest, OnWalletProperties);
+  FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest, SaveActivityInfoCoalesced);
+  FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest, SaveActivityInfoRepliesOnWrite);
+  FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest,
+                           LoadActivityInfoReadsBufferedRow);
+  FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest,
+                           NormalizeDoesNotFlushActivityInfos);
+  FRIEND_TEST_ALL_PREFIXES(RewardsServiceTest, PrefetchedStateDiscarded);
 
   const base::OneShotEvent& ready() const { return ready_; }
   void OnLedgerStateSaved(ledger::LedgerCallbackHandler* handler,
@@ -318,6 +327,11 @@ class RewardsServiceImpl : public RewardsService,
   void OnActivityInfoSaved(ledger::PublisherInfoCallback callback,
                             ledger::PublisherInfoPtr info,
                             bool success);
+  void FlushActivityInfos();
+  void OnActivityInfosSaved(
+      std::vector<base::OnceCallback<void(bool)>> callbacks,
+      bool success);
+  void FlushPostData();
   void OnActivityInfoLoaded(ledger::PublisherInfoCallback callback,
                             const std::string& publisher_key,
                             ledger::PublisherInfoList list);
@@ -334,11 +348,19 @@ class RewardsServiceImpl : public RewardsService,
   void OnPublishersListSaved(ledger::LedgerCallbackHandler* handler,
                              bool success);
   void OnTimer(uint32_t timer_id);
+  // Reads the ledger or publisher state file, taking it from a prefetch
+  // when there is one
+  using LoadStateFileCallback = base::OnceCallback<void(const std::string&)>;
+  void LoadStateFile(const base::FilePath& path,
+                     LoadStateFileCallback callback);
+  void PrefetchState(const base::FilePath& path);
+  void OnStatePrefetched(const base::FilePath& path, const std::string& data);
+  void DiscardPrefetchedState(const base::FilePath& path);
   void OnPublisherListLoaded(ledger::LedgerCallbackHandler* handler,
                              const std::string& data);
   void OnSavedState(ledger::OnSaveCallback callback, bool success);
   void OnLoadedState(ledger::OnLoadCallback callback,
-                                  const std::string& value);
+                     const std::pair<ledger::Result, std::string>& state);
   void OnResetState(ledger::OnResetCallback callback,
                                  bool success);
   void OnTipPublisherInfoSaved(const ledger::Result result,
@@ -630,7 +652,7 @@ class RewardsServiceImpl : public RewardsService,
   // Mojo Proxy methods
   void OnGetTransactionHistory(
       GetTransactionHistoryCallback callback,
-      const std::string& transactions);
+      bat_ledger::mojom::TransactionsInfoPtr info);
   void OnGetAllBalanceReports(
       const GetAllBalanceReportsCallback& callback,
       const base::flat_map<std::string, ledger::BalanceReportInfoPtr> reports);
@@ -641,6 +663,22 @@ class RewardsServiceImpl : public RewardsService,
       ledger::AutoContributePropsPtr props);
   void OnGetRewardsInternalsInfo(GetRewardsInternalsInfoCallback callback,
                                  ledger::RewardsInternalsInfoPtr info);
+  void OnGetDatabaseQueryStats(
+      GetRewardsInternalsInfoCallback callback,
+      std::unique_ptr<brave_rewards::RewardsInternalsInfo> info,
+      PublisherInfoDatabase::QueryStatsMap stats);
+  // Wraps the reply to a call into the ledger so the time until it arrives is
+  // recorded for rewards internals under |method|
+  template <typename... Args>
+  base::OnceCallback<void(Args...)> TimeLedgerCall(
+      const char* method,
+      base::OnceCallback<void(Args...)> callback);
+  template <typename... Args>
+  void OnLedgerCallReplied(const char* method,
+                           base::TimeTicks start_time,
+                           base::OnceCallback<void(Args...)> callback,
+                           Args... args);
+  void RecordStateWrite(const std::string& name, size_t size);
   void SetRewardsMainEnabledPref(bool enabled);
   void SetRewardsMainEnabledMigratedPref(bool enabled);
   void OnRefreshPublisher(
@@ -677,6 +715,46 @@ class RewardsServiceImpl : public RewardsService,
   const base::FilePath publisher_list_path_;
   const base::FilePath rewards_base_path_;
   std::unique_ptr<PublisherInfoDatabase> publisher_info_backend_;
+  // State files read at startup before the ledger asked for them. The
+  // callback is set when the ledger asks before the read has finished. They
+  // are discarded when the file is saved or the ledger restarts
+  struct PrefetchedState {
+    bool loaded = false;
+    std::string data;
+    LoadStateFileCallback callback;
+  };
+  std::map<base::FilePath, PrefetchedState> prefetched_states_;
+  // When the ledger was last started, until the wallet is initialized and
+  // the publisher list has loaded
+  base::TimeTicks ledger_start_time_;
+  base::TimeTicks publisher_list_start_time_;
+  // Shown in rewards internals, see TimeLedgerCall and RecordStateWrite
+  std::map<std::string, LedgerCallStats> ledger_call_stats_;
+  struct StateWriteStats {
+    int count = 0;
+    uint64_t total_bytes = 0;
+    uint64_t last_bytes = 0;
+    base::Time first_write_time;
+  };
+  std::map<std::string, StateWriteStats> state_write_stats_;
+  // Activity saved by the ledger and not yet written, keyed by publisher and
+  // reconcile stamp. Whole activity list reads merge it in and normalization
+  // updates it in place. Anything else which reads or writes publisher_info
+  // or activity_info flushes it first, so the database sees the same order
+  std::map<std::pair<std::string, uint64_t>, ledger::PublisherInfoPtr>
+      pending_activity_infos_;
+  // Replies to the saves in |pending_activity_infos_|, run after the write
+  std::vector<base::OnceCallback<void(bool)>> pending_activity_info_callbacks_;
+  std::unique_ptr<base::OneShotTimer> activity_info_flush_timer_;
+  // Media link request bodies not yet sent to the ledger, by tab and media
+  // link. The ledger parses them, the browser only batches them
+  struct PendingPostData {
+    GURL first_party_url;
+    GURL referrer;
+    std::vector<std::string> post_data;
+  };
+  std::map<std::pair<uint32_t, GURL>, PendingPostData> pending_post_data_;
+  std::unique_ptr<base::OneShotTimer> post_data_flush_timer_;
   std::unique_ptr<RewardsNotificationServiceImpl> notification_service_;
   base::ObserverList<RewardsServicePrivateObserver> private_observers_;
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -4,8 +4,11 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <map>
+#include <string>
+#include <utility>
 
 #include "base/files/scoped_temp_dir.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_rewards/browser/wallet_properties.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
 #include "brave/components/brave_rewards/browser/rewards_service_impl.h"
@@ -13,6 +16,7 @@
 #include "brave/components/brave_rewards/browser/test_util.h"
 #include "chrome/browser/profiles/profile.h"
 #include "content/public/test/test_browser_thread_bundle.h"
+#include "content/public/test/test_utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -98,6 +102,136 @@ TEST_F(RewardsServiceTest, OnWalletProperties) {
   rewards_service()->OnWalletProperties(ledger::Result::LEDGER_ERROR, nullptr);
 }
 
+TEST_F(RewardsServiceTest, SaveActivityInfoCoalesced) {
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->reconcile_stamp = 10;
+  info->visits = 1;
+  info->duration = 20;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  info->visits = 2;
+  info->duration = 40;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  info->reconcile_stamp = 20;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  const auto& pending = rewards_service()->pending_activity_infos_;
+  ASSERT_EQ(2u, pending.size());
+  const auto& first = pending.at(std::make_pair(std::string("brave.com"),
+                                                uint64_t(10)));
+  EXPECT_EQ(2u, first->visits);
+  EXPECT_EQ(40u, first->duration);
+  EXPECT_TRUE(rewards_service()->activity_info_flush_timer_->IsRunning());
+
+  rewards_service()->FlushActivityInfos();
+  EXPECT_TRUE(pending.empty());
+  EXPECT_FALSE(rewards_service()->activity_info_flush_timer_->IsRunning());
+}
+
+TEST_F(RewardsServiceTest, SaveActivityInfoRepliesOnWrite) {
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->reconcile_stamp = 10;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  // Nothing is written yet, so the ledger doesn't hear back either
+  content::RunAllTasksUntilIdle();
+  const auto& callbacks = rewards_service()->pending_activity_info_callbacks_;
+  EXPECT_EQ(1u, callbacks.size());
+
+  rewards_service()->FlushActivityInfos();
+  EXPECT_TRUE(callbacks.empty());
+}
+
+TEST_F(RewardsServiceTest, LoadActivityInfoReadsBufferedRow) {
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->reconcile_stamp = 10;
+  info->visits = 3;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->id = "brave.com";
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL;
+  filter->reconcile_stamp = 10;
+
+  ledger::Result result = ledger::Result::LEDGER_ERROR;
+  ledger::PublisherInfoPtr loaded;
+  rewards_service()->LoadActivityInfo(std::move(filter),
+      [&result, &loaded](ledger::Result load_result,
+                         ledger::PublisherInfoPtr load_info) {
+        result = load_result;
+        loaded = std::move(load_info);
+      });
+  content::RunAllTasksUntilIdle();
+
+  EXPECT_EQ(ledger::Result::LEDGER_OK, result);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(3u, loaded->visits);
+
+  // The row was read back without writing it
+  EXPECT_EQ(1u, rewards_service()->pending_activity_infos_.size());
+  EXPECT_TRUE(rewards_service()->activity_info_flush_timer_->IsRunning());
+}
+
+TEST_F(RewardsServiceTest, NormalizeDoesNotFlushActivityInfos) {
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->reconcile_stamp = 10;
+  info->visits = 1;
+  info->score = 2.0;
+  rewards_service()->SaveActivityInfo(info->Clone(),
+      [](ledger::Result, ledger::PublisherInfoPtr) {});
+
+  // The same whole-list read the ledger makes to normalize the synopsis
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+  filter->reconcile_stamp = 10;
+  rewards_service()->GetActivityInfoList(0, 0, std::move(filter),
+      [](ledger::PublisherInfoList, uint32_t) {});
+  content::RunAllTasksUntilIdle();
+
+  const auto& pending = rewards_service()->pending_activity_infos_;
+  ASSERT_EQ(1u, pending.size());
+  EXPECT_TRUE(rewards_service()->activity_info_flush_timer_->IsRunning());
+
+  // Saving the normalized list updates the buffered row instead of flushing
+  info->percent = 100;
+  info->weight = 100.0;
+  ledger::PublisherInfoList list;
+  list.push_back(info->Clone());
+  rewards_service()->SaveNormalizedPublisherList(std::move(list));
+
+  ASSERT_EQ(1u, pending.size());
+  const auto& buffered = pending.at(std::make_pair(std::string("brave.com"),
+                                                   uint64_t(10)));
+  EXPECT_EQ(100u, buffered->percent);
+  EXPECT_EQ(100.0, buffered->weight);
+  EXPECT_TRUE(rewards_service()->activity_info_flush_timer_->IsRunning());
+}
+
+TEST_F(RewardsServiceTest, PrefetchedStateDiscarded) {
+  content::RunAllTasksUntilIdle();
+  const auto& prefetched = rewards_service()->prefetched_states_;
+  ASSERT_EQ(2u, prefetched.size());
+
+  // A save makes the prefetched contents stale
+  rewards_service()->SavePublisherState("{}", nullptr);
+  EXPECT_EQ(0u, prefetched.count(rewards_service()->publisher_state_path_));
+  EXPECT_EQ(1u, prefetched.count(rewards_service()->ledger_state_path_));
+
+  // So does a ledger restart, the previous ledger may have saved since
+  rewards_service()->ConnectionClosed();
+  EXPECT_TRUE(prefetched.empty());
+}
+
 // add test for strange entries
 
 }  // namespace brave_rewards
@@ -9,6 +9,8 @@ import { connect } from 'react-redux'
 // Components
 import { CurrentReconcile } from './currentReconcile'
 import { KeyInfoSeed } from './keyInfoSeed'
+import { LatencyTable } from './latencyTable'
+import { StateWriteTable } from './stateWriteTable'
 import { WalletPaymentId } from './walletPaymentId'
 
 // Utils
@@ -54,6 +56,19 @@ export class RewardsInternalsPage extends React.Component<Props, {}> {
           <div>
             <span i18n-content='bootStamp'/>: {new Date(info.bootStamp * 1000).toLocaleDateString()}
           </div>
+          <hr/>
+          <LatencyTable title='ledgerCalls' items={info.ledgerCalls || []} />
+          <LatencyTable title='databaseQueries' items={info.databaseQueries || []} />
+          <StateWriteTable items={info.stateWrites || []} />
+          <div>
+            <span i18n-content='publisherListCount'/>: {info.publisherListCount || 0}
+          </div>
+          <div>
+            <span i18n-content='publisherListBytes'/>: {info.publisherListBytes || 0}
+          </div>
+          <div>
+            <span i18n-content='pendingTimers'/>: {info.pendingTimers || 0}
+          </div>
           <button type='button' style={{ marginTop: '10px' }} onClick={this.onRefresh}>{getLocale('refreshButton')}</button>
         </div>)
     } else {
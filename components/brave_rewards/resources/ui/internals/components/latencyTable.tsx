@@ -0,0 +1,36 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+
+interface Props {
+  title: string
+  items: RewardsInternals.Latency[]
+}
+
+export const LatencyTable = (props: Props) => (
+  <div>
+    <span i18n-content={props.title}/>
+    <table>
+      <thead>
+        <tr>
+          <th i18n-content='name'/>
+          <th i18n-content='count'/>
+          <th i18n-content='averageMs'/>
+          <th i18n-content='maxMs'/>
+        </tr>
+      </thead>
+      <tbody>
+        {props.items.map((item) => (
+          <tr key={item.name}>
+            <td>{item.name}</td>
+            <td>{item.count || 0}</td>
+            <td>{(item.average || 0).toFixed(2)}</td>
+            <td>{(item.max || 0).toFixed(2)}</td>
+          </tr>
+        ))}
+      </tbody>
+    </table>
+  </div>
+)
@@ -14,7 +14,13 @@ const defaultState: RewardsInternals.State = {
     currentReconciles: [],
     personaId: '',
     userId: '',
-    bootStamp: 0
+    bootStamp: 0,
+    ledgerCalls: [],
+    databaseQueries: [],
+    stateWrites: [],
+    publisherListCount: 0,
+    publisherListBytes: 0,
+    pendingTimers: 0
   }
 }
 
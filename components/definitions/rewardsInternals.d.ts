@@ -12,6 +12,12 @@ declare namespace RewardsInternals {
       personaId: string
       userId: string
       bootStamp: number
+      ledgerCalls: Latency[]
+      databaseQueries: Latency[]
+      stateWrites: StateWrite[]
+      publisherListCount: number
+      publisherListBytes: number
+      pendingTimers: number
     }
   }
 
@@ -21,4 +27,19 @@ declare namespace RewardsInternals {
     retryStep: number
     retryLevel: number
   }
+
+  export interface Latency {
+    name: string
+    count: number
+    average: number
+    max: number
+  }
+
+  export interface StateWrite {
+    name: string
+    count: number
+    totalBytes: number
+    lastBytes: number
+    writesPerHour: number
+  }
 }
@@ -11,6 +11,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
 
@@ -124,9 +125,9 @@ void BatAdsClientMojoBridge::GetClientInfo(ads::ClientInfo* info) const {
   if (!connected())
     return;
 
-  std::string out_info_json;
-  bat_ads_client_->GetClientInfo(info->ToJson(), &out_info_json);
-  info->FromJson(out_info_json);
+  mojom::ClientInfoPtr out_info;
+  bat_ads_client_->GetClientInfo(ToMojom(*info), &out_info);
+  *info = FromMojom(*out_info);
 }
 
 const std::vector<std::string> BatAdsClientMojoBridge::GetLocales() const {
@@ -143,7 +144,7 @@ void BatAdsClientMojoBridge::ShowNotification(
   if (!connected())
     return;
 
-  bat_ads_client_->ShowNotification(info->ToJson());
+  bat_ads_client_->ShowNotification(ToMojom(*info));
 }
 
 void BatAdsClientMojoBridge::CloseNotification(const std::string& id) {
@@ -158,7 +159,7 @@ void BatAdsClientMojoBridge::SetCatalogIssuers(
   if (!connected())
     return;
 
-  bat_ads_client_->SetCatalogIssuers(info->ToJson());
+  bat_ads_client_->SetCatalogIssuers(ToMojom(*info));
 }
 
 void BatAdsClientMojoBridge::ConfirmAd(
@@ -166,7 +167,7 @@ void BatAdsClientMojoBridge::ConfirmAd(
   if (!connected())
     return;
 
-  bat_ads_client_->ConfirmAd(info->ToJson());
+  bat_ads_client_->ConfirmAd(ToMojom(*info));
 }
 
 uint32_t BatAdsClientMojoBridge::SetTimer(const uint64_t time_offset) {
@@ -258,17 +259,24 @@ void BatAdsClientMojoBridge::SaveBundleState(
     return;
   }
 
-  bat_ads_client_->SaveBundleState(bundle_state->ToJson(),
+  bat_ads_client_->SaveBundleState(ToMojom(*bundle_state),
       base::BindOnce(&OnSaveBundleState, std::move(callback)));
 }
 
 const std::string BatAdsClientMojoBridge::LoadJsonSchema(
     const std::string& name) {
+  auto it = json_schemas_.find(name);
+  if (it != json_schemas_.end())
+    return it->second;
+
   if (!connected())
     return "{}";
 
   std::string json;
-  bat_ads_client_->LoadJsonSchema(name, &json);
+  if (!bat_ads_client_->LoadJsonSchema(name, &json))
+    return json;
+
+  json_schemas_[name] = json;
   return json;
 }
 
@@ -290,20 +298,8 @@ void BatAdsClientMojoBridge::Reset(const std::string& name,
 void OnGetAds(const ads::OnGetAdsCallback& callback,
               int32_t result,
               const std::string& category,
-              const std::vector<std::string>& ad_info_json_list) {
-  std::vector<ads::AdInfo> ad_info_list;
-
-  for (const auto it : ad_info_json_list) {
-    ads::AdInfo ad_info;
-    if (ad_info.FromJson(it) == ads::Result::SUCCESS) {
-      ad_info_list.push_back(ad_info);
-    } else {
-      callback(ads::Result::FAILED, category, std::vector<ads::AdInfo>());
-      return;
-    }
-  }
-
-  callback(ToAdsResult(result), category, ad_info_list);
+              std::vector<mojom::AdInfoPtr> ad_info_list) {
+  callback(ToAdsResult(result), category, FromMojom(ad_info_list));
 }
 
 void BatAdsClientMojoBridge::GetAds(
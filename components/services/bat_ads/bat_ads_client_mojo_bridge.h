@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_CLIENT_MOJO_BRIDGE_H_
 #define BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_CLIENT_MOJO_BRIDGE_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -73,6 +74,10 @@ class BatAdsClientMojoBridge : public ads::AdsClient {
 
   mojom::BatAdsClientAssociatedPtr bat_ads_client_;
 
+  // Schemas are bundled resources, so they are only fetched once over the
+  // synchronous LoadJsonSchema call
+  std::map<std::string, std::string> json_schemas_;
+
   DISALLOW_COPY_AND_ASSIGN(BatAdsClientMojoBridge);
 };
 
@@ -0,0 +1,76 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "brave/components/services/bat_ads/bat_ads_client_mojo_bridge.h"
+
+#include "base/test/scoped_task_environment.h"
+#include "bat/ads/internal/ads_client_mock.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_client_mojo_bridge.h"
+#include "mojo/public/cpp/bindings/associated_binding.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatAdsClientMojoBridgeTest.*
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace bat_ads {
+
+class BatAdsClientMojoBridgeTest : public ::testing::Test {
+ protected:
+  BatAdsClientMojoBridgeTest() :
+      mock_ads_client_(std::make_unique<NiceMock<ads::MockAdsClient>>()),
+      ads_client_mojo_bridge_(
+          std::make_unique<AdsClientMojoBridge>(mock_ads_client_.get())),
+      binding_(ads_client_mojo_bridge_.get()) {
+    mojom::BatAdsClientAssociatedPtrInfo client_info;
+    binding_.Bind(mojo::MakeRequestAssociatedWithDedicatedPipe(&client_info));
+
+    bat_ads_client_mojo_bridge_ =
+        std::make_unique<BatAdsClientMojoBridge>(std::move(client_info));
+  }
+
+  base::test::ScopedTaskEnvironment scoped_task_environment_;
+  std::unique_ptr<NiceMock<ads::MockAdsClient>> mock_ads_client_;
+  std::unique_ptr<AdsClientMojoBridge> ads_client_mojo_bridge_;
+  mojo::AssociatedBinding<mojom::BatAdsClient> binding_;
+  std::unique_ptr<BatAdsClientMojoBridge> bat_ads_client_mojo_bridge_;
+};
+
+TEST_F(BatAdsClientMojoBridgeTest, LoadJsonSchemaIsCached) {
+  EXPECT_CALL(*mock_ads_client_, LoadJsonSchema("catalog-schema.json"))
+      .Times(1)
+      .WillOnce(Return("{\"type\": \"object\"}"));
+
+  EXPECT_EQ("{\"type\": \"object\"}",
+      bat_ads_client_mojo_bridge_->LoadJsonSchema("catalog-schema.json"));
+
+  // The second load is served without a round trip to the client
+  EXPECT_EQ("{\"type\": \"object\"}",
+      bat_ads_client_mojo_bridge_->LoadJsonSchema("catalog-schema.json"));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, LoadJsonSchemaIsCachedPerName) {
+  EXPECT_CALL(*mock_ads_client_, LoadJsonSchema("catalog-schema.json"))
+      .Times(1)
+      .WillOnce(Return("{\"title\": \"catalog\"}"));
+  EXPECT_CALL(*mock_ads_client_, LoadJsonSchema("bundle-schema.json"))
+      .Times(1)
+      .WillOnce(Return("{\"title\": \"bundle\"}"));
+
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ("{\"title\": \"catalog\"}",
+        bat_ads_client_mojo_bridge_->LoadJsonSchema("catalog-schema.json"));
+    EXPECT_EQ("{\"title\": \"bundle\"}",
+        bat_ads_client_mojo_bridge_->LoadJsonSchema("bundle-schema.json"));
+  }
+}
+
+}  // namespace bat_ads
@@ -9,6 +9,7 @@
 
 #include "bat/ads/ads.h"
 #include "brave/components/services/bat_ads/bat_ads_client_mojo_bridge.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
 
 using std::placeholders::_1;
 
@@ -77,6 +78,12 @@ void BatAdsImpl::ChangeLocale(const std::string& locale) {
   ads_->ChangeLocale(locale);
 }
 
+void BatAdsImpl::ShouldClassifyPage(
+    const std::string& url,
+    ShouldClassifyPageCallback callback) {
+  std::move(callback).Run(ads_->ShouldClassifyPage(url));
+}
+
 void BatAdsImpl::ClassifyPage(
     const std::string& url,
     const std::string& page) {
@@ -132,7 +139,7 @@ void BatAdsImpl::GetNotificationForId(
     GetNotificationForIdCallback callback) {
   ads::NotificationInfo notification;
   ads_->GetNotificationForId(id, &notification);
-  std::move(callback).Run(notification.ToJson());
+  std::move(callback).Run(ToMojom(notification));
 }
 
 void BatAdsImpl::OnNotificationEvent(
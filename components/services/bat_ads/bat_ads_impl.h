@@ -37,6 +37,9 @@ class BatAdsImpl :
   void Shutdown(ShutdownCallback callback) override;
   void SetConfirmationsIsReady(const bool is_ready) override;
   void ChangeLocale(const std::string& locale) override;
+  void ShouldClassifyPage(
+      const std::string& url,
+      ShouldClassifyPageCallback callback) override;
   void ClassifyPage(const std::string& url, const std::string& page) override;
   void ServeSampleAd() override;
   void OnTimer(const uint32_t timer_id) override;
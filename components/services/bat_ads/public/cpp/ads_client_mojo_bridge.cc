@@ -14,6 +14,7 @@
 #include "base/callback.h"
 #include "base/containers/flat_map.h"
 #include "bat/ads/ads.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
 
 using std::placeholders::_1;
 using std::placeholders::_2;
@@ -151,21 +152,19 @@ void AdsClientMojoBridge::KillTimer(uint32_t timer_id) {
   ads_client_->KillTimer(timer_id);
 }
 
-bool AdsClientMojoBridge::GetClientInfo(const std::string& client_info,
-                                     std::string* out_client_info) {
-  ads::ClientInfo info;
-  info.FromJson(client_info);
+bool AdsClientMojoBridge::GetClientInfo(mojom::ClientInfoPtr client_info,
+                                        mojom::ClientInfoPtr* out_client_info) {
+  ads::ClientInfo info = FromMojom(*client_info);
   ads_client_->GetClientInfo(&info);
-  *out_client_info = info.ToJson();
+  *out_client_info = ToMojom(info);
   return true;
 }
 
-void AdsClientMojoBridge::GetClientInfo(const std::string& client_info,
-                                     GetClientInfoCallback callback) {
-  ads::ClientInfo info;
-  info.FromJson(client_info);
+void AdsClientMojoBridge::GetClientInfo(mojom::ClientInfoPtr client_info,
+                                        GetClientInfoCallback callback) {
+  ads::ClientInfo info = FromMojom(*client_info);
   ads_client_->GetClientInfo(&info);
-  std::move(callback).Run(info.ToJson());
+  std::move(callback).Run(ToMojom(info));
 }
 
 void AdsClientMojoBridge::EventLog(const std::string& json) {
@@ -293,10 +292,8 @@ void AdsClientMojoBridge::LoadSampleBundle(
 }
 
 void AdsClientMojoBridge::ShowNotification(
-    const std::string& notification_info) {
-  auto info = std::make_unique<ads::NotificationInfo>();
-  if (info->FromJson(notification_info) == ads::Result::SUCCESS)
-    ads_client_->ShowNotification(std::move(info));
+    mojom::NotificationInfoPtr notification_info) {
+  ads_client_->ShowNotification(FromMojom(*notification_info));
 }
 
 void AdsClientMojoBridge::CloseNotification(const std::string& id) {
@@ -304,17 +301,13 @@ void AdsClientMojoBridge::CloseNotification(const std::string& id) {
 }
 
 void AdsClientMojoBridge::SetCatalogIssuers(
-    const std::string& issuers_info) {
-  auto info = std::make_unique<ads::IssuersInfo>();
-  if (info->FromJson(issuers_info) == ads::Result::SUCCESS) {
-    ads_client_->SetCatalogIssuers(std::move(info));
-  }
+    mojom::IssuersInfoPtr issuers_info) {
+  ads_client_->SetCatalogIssuers(FromMojom(*issuers_info));
 }
 
-void AdsClientMojoBridge::ConfirmAd(const std::string& notification_info) {
-  auto info = std::make_unique<ads::NotificationInfo>();
-  if (info->FromJson(notification_info) == ads::Result::SUCCESS)
-    ads_client_->ConfirmAd(std::move(info));
+void AdsClientMojoBridge::ConfirmAd(
+    mojom::NotificationInfoPtr notification_info) {
+  ads_client_->ConfirmAd(FromMojom(*notification_info));
 }
 
 // static
@@ -326,22 +319,13 @@ void AdsClientMojoBridge::OnSaveBundleState(
   delete holder;
 }
 
-void AdsClientMojoBridge::SaveBundleState(const std::string& bundle_state_json,
-                       SaveBundleStateCallback callback) {
+void AdsClientMojoBridge::SaveBundleState(mojom::BundleStatePtr bundle_state,
+                                          SaveBundleStateCallback callback) {
   // this gets deleted in OnSaveBundleState
   auto* holder = new CallbackHolder<SaveBundleStateCallback>(
       AsWeakPtr(), std::move(callback));
-  auto bundle_state = std::make_unique<ads::BundleState>();
-
-  auto schema = ads_client_->LoadJsonSchema(ads::_bundle_schema_name);
-
-  if (bundle_state->FromJson(bundle_state_json, schema) ==
-      ads::Result::SUCCESS) {
-    ads_client_->SaveBundleState(std::move(bundle_state),
-        std::bind(AdsClientMojoBridge::OnSaveBundleState, holder, _1));
-  } else {
-    std::move(holder->get()).Run(ToMojomResult(ads::Result::FAILED));
-  }
+  ads_client_->SaveBundleState(FromMojom(*bundle_state),
+      std::bind(AdsClientMojoBridge::OnSaveBundleState, holder, _1));
 }
 
 // static
@@ -351,11 +335,8 @@ void AdsClientMojoBridge::OnGetAds(
     const std::string& category,
     const std::vector<ads::AdInfo>& ad_info) {
   if (holder->is_valid()) {
-    std::vector<std::string> ad_info_json;
-    for (const auto it : ad_info) {
-      ad_info_json.push_back(it.ToJson());
-    }
-    std::move(holder->get()).Run(ToMojomResult(result), category, ad_info_json);
+    std::move(holder->get()).Run(ToMojomResult(result), category,
+        ToMojom(ad_info));
   }
   delete holder;
 }
@@ -48,9 +48,9 @@ class AdsClientMojoBridge : public mojom::BatAdsClient,
   bool LoadJsonSchema(const std::string& name, std::string* out_json) override;
   void LoadJsonSchema(const std::string& name,
                       LoadJsonSchemaCallback callback) override;
-  bool GetClientInfo(const std::string& client_info,
-                     std::string* out_client_info) override;
-  void GetClientInfo(const std::string& client_info,
+  bool GetClientInfo(mojom::ClientInfoPtr client_info,
+                     mojom::ClientInfoPtr* out_client_info) override;
+  void GetClientInfo(mojom::ClientInfoPtr client_info,
                      GetClientInfoCallback callback) override;
 
   void EventLog(const std::string& json) override;
@@ -70,11 +70,11 @@ class AdsClientMojoBridge : public mojom::BatAdsClient,
                   int32_t method,
                   URLRequestCallback callback) override;
   void LoadSampleBundle(LoadSampleBundleCallback callback) override;
-  void ShowNotification(const std::string& notification_info) override;
+  void ShowNotification(mojom::NotificationInfoPtr notification_info) override;
   void CloseNotification(const std::string& id) override;
-  void SetCatalogIssuers(const std::string& issuers_info) override;
-  void ConfirmAd(const std::string& notification_info) override;
-  void SaveBundleState(const std::string& bundle_state,
+  void SetCatalogIssuers(mojom::IssuersInfoPtr issuers_info) override;
+  void ConfirmAd(mojom::NotificationInfoPtr notification_info) override;
+  void SaveBundleState(mojom::BundleStatePtr bundle_state,
                        SaveBundleStateCallback callback) override;
   void GetAds(const std::string& category,
               GetAdsCallback callback) override;
@@ -0,0 +1,156 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
+
+#include <utility>
+
+namespace bat_ads {
+
+mojom::ClientInfoPtr ToMojom(const ads::ClientInfo& info) {
+  auto client_info = mojom::ClientInfo::New();
+  client_info->platform = info.platform;
+  return client_info;
+}
+
+ads::ClientInfo FromMojom(const mojom::ClientInfo& info) {
+  ads::ClientInfo client_info;
+  client_info.platform =
+      static_cast<ads::ClientInfoPlatformType>(info.platform);
+  return client_info;
+}
+
+mojom::AdInfoPtr ToMojom(const ads::AdInfo& info) {
+  auto ad_info = mojom::AdInfo::New();
+  ad_info->creative_set_id = info.creative_set_id;
+  ad_info->campaign_id = info.campaign_id;
+  ad_info->start_timestamp = info.start_timestamp;
+  ad_info->end_timestamp = info.end_timestamp;
+  ad_info->daily_cap = info.daily_cap;
+  ad_info->per_day = info.per_day;
+  ad_info->total_max = info.total_max;
+  ad_info->regions = info.regions;
+  ad_info->advertiser = info.advertiser;
+  ad_info->notification_text = info.notification_text;
+  ad_info->notification_url = info.notification_url;
+  ad_info->uuid = info.uuid;
+  return ad_info;
+}
+
+ads::AdInfo FromMojom(const mojom::AdInfo& info) {
+  ads::AdInfo ad_info;
+  ad_info.creative_set_id = info.creative_set_id;
+  ad_info.campaign_id = info.campaign_id;
+  ad_info.start_timestamp = info.start_timestamp;
+  ad_info.end_timestamp = info.end_timestamp;
+  ad_info.daily_cap = info.daily_cap;
+  ad_info.per_day = info.per_day;
+  ad_info.total_max = info.total_max;
+  ad_info.regions = info.regions;
+  ad_info.advertiser = info.advertiser;
+  ad_info.notification_text = info.notification_text;
+  ad_info.notification_url = info.notification_url;
+  ad_info.uuid = info.uuid;
+  return ad_info;
+}
+
+std::vector<mojom::AdInfoPtr> ToMojom(const std::vector<ads::AdInfo>& list) {
+  std::vector<mojom::AdInfoPtr> ad_info_list;
+  ad_info_list.reserve(list.size());
+  for (const auto& info : list) {
+    ad_info_list.push_back(ToMojom(info));
+  }
+  return ad_info_list;
+}
+
+std::vector<ads::AdInfo> FromMojom(const std::vector<mojom::AdInfoPtr>& list) {
+  std::vector<ads::AdInfo> ad_info_list;
+  ad_info_list.reserve(list.size());
+  for (const auto& info : list) {
+    ad_info_list.push_back(FromMojom(*info));
+  }
+  return ad_info_list;
+}
+
+mojom::BundleStatePtr ToMojom(const ads::BundleState& state) {
+  auto bundle_state = mojom::BundleState::New();
+  bundle_state->catalog_id = state.catalog_id;
+  bundle_state->catalog_version = state.catalog_version;
+  bundle_state->catalog_ping = state.catalog_ping;
+  bundle_state->catalog_last_updated_timestamp_in_seconds =
+      state.catalog_last_updated_timestamp_in_seconds;
+  for (const auto& category : state.categories) {
+    bundle_state->categories.emplace(category.first, ToMojom(category.second));
+  }
+  return bundle_state;
+}
+
+std::unique_ptr<ads::BundleState> FromMojom(const mojom::BundleState& state) {
+  auto bundle_state = std::make_unique<ads::BundleState>();
+  bundle_state->catalog_id = state.catalog_id;
+  bundle_state->catalog_version = state.catalog_version;
+  bundle_state->catalog_ping = state.catalog_ping;
+  bundle_state->catalog_last_updated_timestamp_in_seconds =
+      state.catalog_last_updated_timestamp_in_seconds;
+  for (const auto& category : state.categories) {
+    bundle_state->categories.emplace(category.first,
+        FromMojom(category.second));
+  }
+  return bundle_state;
+}
+
+mojom::NotificationInfoPtr ToMojom(const ads::NotificationInfo& info) {
+  auto notification_info = mojom::NotificationInfo::New();
+  notification_info->id = info.id;
+  notification_info->creative_set_id = info.creative_set_id;
+  notification_info->category = info.category;
+  notification_info->advertiser = info.advertiser;
+  notification_info->text = info.text;
+  notification_info->url = info.url;
+  notification_info->uuid = info.uuid;
+  notification_info->type = info.type.value();
+  return notification_info;
+}
+
+std::unique_ptr<ads::NotificationInfo> FromMojom(
+    const mojom::NotificationInfo& info) {
+  auto notification_info = std::make_unique<ads::NotificationInfo>();
+  notification_info->id = info.id;
+  notification_info->creative_set_id = info.creative_set_id;
+  notification_info->category = info.category;
+  notification_info->advertiser = info.advertiser;
+  notification_info->text = info.text;
+  notification_info->url = info.url;
+  notification_info->uuid = info.uuid;
+  notification_info->type =
+      static_cast<ads::ConfirmationType::Value>(info.type);
+  return notification_info;
+}
+
+mojom::IssuersInfoPtr ToMojom(const ads::IssuersInfo& info) {
+  auto issuers_info = mojom::IssuersInfo::New();
+  issuers_info->public_key = info.public_key;
+  for (const auto& issuer : info.issuers) {
+    auto issuer_info = mojom::IssuerInfo::New();
+    issuer_info->name = issuer.name;
+    issuer_info->public_key = issuer.public_key;
+    issuers_info->issuers.push_back(std::move(issuer_info));
+  }
+  return issuers_info;
+}
+
+std::unique_ptr<ads::IssuersInfo> FromMojom(const mojom::IssuersInfo& info) {
+  auto issuers_info = std::make_unique<ads::IssuersInfo>();
+  issuers_info->public_key = info.public_key;
+  for (const auto& issuer : info.issuers) {
+    ads::IssuerInfo issuer_info;
+    issuer_info.name = issuer->name;
+    issuer_info.public_key = issuer->public_key;
+    issuers_info->issuers.push_back(issuer_info);
+  }
+  return issuers_info;
+}
+
+}  // namespace bat_ads
@@ -0,0 +1,45 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
+#define BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
+
+#include <memory>
+#include <vector>
+
+#include "bat/ads/ad_info.h"
+#include "bat/ads/bundle_state.h"
+#include "bat/ads/client_info.h"
+#include "bat/ads/issuers_info.h"
+#include "bat/ads/notification_info.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+
+// Converts between the bat/ads structs and their typed mojom counterparts, so
+// payloads cross the bat_ads service boundary without a JSON round trip
+
+namespace bat_ads {
+
+mojom::ClientInfoPtr ToMojom(const ads::ClientInfo& info);
+ads::ClientInfo FromMojom(const mojom::ClientInfo& info);
+
+mojom::AdInfoPtr ToMojom(const ads::AdInfo& info);
+ads::AdInfo FromMojom(const mojom::AdInfo& info);
+
+std::vector<mojom::AdInfoPtr> ToMojom(const std::vector<ads::AdInfo>& list);
+std::vector<ads::AdInfo> FromMojom(const std::vector<mojom::AdInfoPtr>& list);
+
+mojom::BundleStatePtr ToMojom(const ads::BundleState& state);
+std::unique_ptr<ads::BundleState> FromMojom(const mojom::BundleState& state);
+
+mojom::NotificationInfoPtr ToMojom(const ads::NotificationInfo& info);
+std::unique_ptr<ads::NotificationInfo> FromMojom(
+    const mojom::NotificationInfo& info);
+
+mojom::IssuersInfoPtr ToMojom(const ads::IssuersInfo& info);
+std::unique_ptr<ads::IssuersInfo> FromMojom(const mojom::IssuersInfo& info);
+
+}  // namespace bat_ads
+
+#endif  // BRAVE_COMPONENTS_SERVICES_BAT_ADS_PUBLIC_CPP_ADS_MOJOM_CONVERSIONS_H_
@@ -0,0 +1,101 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <utility>
+#include <vector>
+
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
+
+#include "base/strings/string_number_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=AdsMojomConversionsTest.*
+
+namespace bat_ads {
+
+namespace {
+
+ads::AdInfo CreateAdInfo(const size_t index) {
+  ads::AdInfo info;
+  info.creative_set_id = "creative_set_" + base::NumberToString(index);
+  info.campaign_id = "campaign_" + base::NumberToString(index);
+  info.start_timestamp = "2000-01-01 00:00:00";
+  info.end_timestamp = "2100-01-01 00:00:00";
+  info.daily_cap = 1;
+  info.per_day = 2;
+  info.total_max = 3;
+  info.regions = {"US", "GB"};
+  info.advertiser = "advertiser";
+  info.notification_text = "text";
+  info.notification_url = "https://brave.com";
+  info.uuid = "uuid_" + base::NumberToString(index);
+  return info;
+}
+
+std::vector<ads::AdInfo> CreateAdInfoList(const size_t count) {
+  std::vector<ads::AdInfo> list;
+  for (size_t i = 0; i < count; i++) {
+    list.push_back(CreateAdInfo(i));
+  }
+
+  return list;
+}
+
+}  // namespace
+
+class AdsMojomConversionsTest : public ::testing::Test {
+ protected:
+  AdsMojomConversionsTest() {
+  }
+
+  ~AdsMojomConversionsTest() override {
+  }
+};
+
+TEST_F(AdsMojomConversionsTest, AdInfoRoundTrip) {
+  const ads::AdInfo info = CreateAdInfo(1);
+
+  mojom::AdInfoPtr ptr = ToMojom(info);
+  const std::vector<uint8_t> data = mojom::AdInfo::Serialize(&ptr);
+
+  mojom::AdInfoPtr deserialized;
+  ASSERT_TRUE(mojom::AdInfo::Deserialize(data, &deserialized));
+
+  const ads::AdInfo result = FromMojom(*deserialized);
+  EXPECT_EQ(info.ToJson(), result.ToJson());
+}
+
+TEST_F(AdsMojomConversionsTest, BundleStateRoundTrip) {
+  ads::BundleState state;
+  state.catalog_id = "catalog";
+  state.catalog_version = 1;
+  state.catalog_ping = 7200000;
+  state.catalog_last_updated_timestamp_in_seconds = 1;
+  state.categories["category"] = CreateAdInfoList(3);
+
+  auto result = FromMojom(*ToMojom(state));
+  EXPECT_EQ(state.ToJson(), result->ToJson());
+}
+
+TEST_F(AdsMojomConversionsTest, AdInfoListRoundTrip) {
+  const std::vector<ads::AdInfo> list = CreateAdInfoList(3);
+
+  std::vector<mojom::AdInfoPtr> ptr_list = ToMojom(list);
+  std::vector<mojom::AdInfoPtr> deserialized_list;
+  for (auto& ptr : ptr_list) {
+    const std::vector<uint8_t> data = mojom::AdInfo::Serialize(&ptr);
+    mojom::AdInfoPtr deserialized;
+    ASSERT_TRUE(mojom::AdInfo::Deserialize(data, &deserialized));
+    deserialized_list.push_back(std::move(deserialized));
+  }
+
+  const std::vector<ads::AdInfo> result = FromMojom(deserialized_list);
+  ASSERT_EQ(list.size(), result.size());
+  for (size_t i = 0; i < list.size(); i++) {
+    EXPECT_EQ(list.at(i).ToJson(), result.at(i).ToJson());
+  }
+}
+
+}  // namespace bat_ads
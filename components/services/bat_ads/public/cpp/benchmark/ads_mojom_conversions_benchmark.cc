@@ -0,0 +1,149 @@
+/* Copyright (c) 2019 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures a GetAds reply crossing the bat_ads service boundary, once in the
+// previous wire format of one JSON string per ad and once as typed mojom
+// structs, serialized and deserialized the way a message would be.
+//
+// ninja -C out/Release brave/components/services/bat_ads/public/cpp:bat_ads_mojom_conversions_benchmark
+// out/Release/bat_ads_mojom_conversions_benchmark
+//
+// Switches:
+//   --ads=<n>             ads in the reply (100, 500 and 1000)
+//   --iterations=<n>      times each reply is converted (20)
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/at_exit.h"
+#include "base/command_line.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "brave/components/services/bat_ads/public/cpp/ads_mojom_conversions.h"
+#include "brave_base/benchmark_util.h"
+#include "mojo/core/embedder/embedder.h"
+
+using brave_base::benchmark::GetSwitchValueAsUint64;
+using brave_base::benchmark::Median;
+
+namespace {
+
+const char kAdsSwitch[] = "ads";
+const char kIterationsSwitch[] = "iterations";
+
+std::vector<ads::AdInfo> CreateAdInfoList(const uint64_t count) {
+  std::vector<ads::AdInfo> list;
+  for (uint64_t i = 0; i < count; i++) {
+    ads::AdInfo info;
+    info.creative_set_id = "creative_set_" + base::NumberToString(i);
+    info.campaign_id = "campaign_" + base::NumberToString(i);
+    info.start_timestamp = "2000-01-01 00:00:00";
+    info.end_timestamp = "2100-01-01 00:00:00";
+    info.daily_cap = 1;
+    info.per_day = 2;
+    info.total_max = 3;
+    info.regions = {"US", "GB"};
+    info.advertiser = "advertiser";
+    info.notification_text = "text";
+    info.notification_url = "https://brave.com";
+    info.uuid = "uuid_" + base::NumberToString(i);
+    list.push_back(info);
+  }
+
+  return list;
+}
+
+size_t JsonRoundTrip(const std::vector<ads::AdInfo>& list) {
+  std::vector<std::string> json_list;
+  for (const auto& info : list) {
+    json_list.push_back(info.ToJson());
+  }
+
+  std::vector<ads::AdInfo> result;
+  for (const auto& json : json_list) {
+    ads::AdInfo info;
+    if (info.FromJson(json) == ads::Result::SUCCESS) {
+      result.push_back(info);
+    }
+  }
+
+  return result.size();
+}
+
+size_t MojomRoundTrip(const std::vector<ads::AdInfo>& list) {
+  std::vector<bat_ads::mojom::AdInfoPtr> ptr_list = bat_ads::ToMojom(list);
+  std::vector<std::vector<uint8_t>> data_list;
+  for (auto& ptr : ptr_list) {
+    data_list.push_back(bat_ads::mojom::AdInfo::Serialize(&ptr));
+  }
+
+  std::vector<bat_ads::mojom::AdInfoPtr> deserialized_list;
+  for (const auto& data : data_list) {
+    bat_ads::mojom::AdInfoPtr ptr;
+    if (bat_ads::mojom::AdInfo::Deserialize(data, &ptr)) {
+      deserialized_list.push_back(std::move(ptr));
+    }
+  }
+
+  return bat_ads::FromMojom(deserialized_list).size();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  base::AtExitManager at_exit_manager;
+  base::CommandLine::Init(argc, argv);
+  mojo::core::Init();
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+
+  std::vector<uint64_t> counts = {100, 500, 1000};
+  if (command_line.HasSwitch(kAdsSwitch)) {
+    counts = {GetSwitchValueAsUint64(command_line, kAdsSwitch, 100)};
+  }
+
+  const uint64_t iterations = std::max<uint64_t>(1,
+      GetSwitchValueAsUint64(command_line, kIterationsSwitch, 20));
+
+  std::cout << std::setw(8) << "ads" << std::setw(14) << "json"
+      << std::setw(14) << "mojom" << std::endl;
+
+  for (const uint64_t count : counts) {
+    const std::vector<ads::AdInfo> list = CreateAdInfoList(count);
+
+    std::vector<base::TimeDelta> json_samples;
+    std::vector<base::TimeDelta> mojom_samples;
+    size_t mismatches = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+      base::TimeTicks start = base::TimeTicks::Now();
+      const size_t json_count = JsonRoundTrip(list);
+      json_samples.push_back(base::TimeTicks::Now() - start);
+
+      start = base::TimeTicks::Now();
+      const size_t mojom_count = MojomRoundTrip(list);
+      mojom_samples.push_back(base::TimeTicks::Now() - start);
+
+      if (json_count != count || mojom_count != count) {
+        mismatches++;
+      }
+    }
+
+    std::cout << std::setw(8) << count << std::fixed << std::setprecision(1)
+        << std::setw(11) << Median(json_samples).InMicrosecondsF() << " us"
+        << std::setw(11) << Median(mojom_samples).InMicrosecondsF() << " us";
+    if (mismatches > 0) {
+      std::cout << "  " << mismatches << " mismatches";
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/logging.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
 #include "mojo/public/cpp/bindings/map.h"
 
 namespace bat_ledger {
@@ -73,8 +75,13 @@ void OnSaveState(const ledger::OnSaveCallback& callback,
 }
 
 void OnLoadState(const ledger::OnLoadCallback& callback,
+                 base::TimeTicks start_time,
                  const ledger::Result result,
                  const std::string& value) {
+  TRACE_EVENT2("browser", "BatLedgerClientMojoProxy::OnLoadState",
+               "size", value.size(),
+               "round_trip_ms",
+               (base::TimeTicks::Now() - start_time).InMillisecondsF());
   callback(result, value);
 }
 
@@ -194,8 +201,13 @@ void BatLedgerClientMojoProxy::OnGrantFinish(ledger::Result result,
 
 void BatLedgerClientMojoProxy::OnLoadLedgerState(
     ledger::OnLoadCallback callback,
+    base::TimeTicks start_time,
     const ledger::Result result,
     const std::string& data) {
+  TRACE_EVENT2("browser", "BatLedgerClientMojoProxy::OnLoadLedgerState",
+               "size", data.size(),
+               "round_trip_ms",
+               (base::TimeTicks::Now() - start_time).InMillisecondsF());
   callback(result, data);
 }
 
@@ -208,13 +220,18 @@ void BatLedgerClientMojoProxy::LoadLedgerState(
 
   bat_ledger_client_->LoadLedgerState(
       base::BindOnce(&BatLedgerClientMojoProxy::OnLoadLedgerState, AsWeakPtr(),
-        std::move(callback)));
+        std::move(callback), base::TimeTicks::Now()));
 }
 
 void BatLedgerClientMojoProxy::OnLoadPublisherState(
     ledger::OnLoadCallback callback,
+    base::TimeTicks start_time,
     const ledger::Result result,
     const std::string& data) {
+  TRACE_EVENT2("browser", "BatLedgerClientMojoProxy::OnLoadPublisherState",
+               "size", data.size(),
+               "round_trip_ms",
+               (base::TimeTicks::Now() - start_time).InMillisecondsF());
   callback(result, data);
 }
 
@@ -227,13 +244,18 @@ void BatLedgerClientMojoProxy::LoadPublisherState(
 
   bat_ledger_client_->LoadPublisherState(
       base::BindOnce(&BatLedgerClientMojoProxy::OnLoadPublisherState,
-        AsWeakPtr(), std::move(callback)));
+        AsWeakPtr(), std::move(callback), base::TimeTicks::Now()));
 }
 
 void BatLedgerClientMojoProxy::OnLoadPublisherList(
     ledger::LedgerCallbackHandler* handler,
+    base::TimeTicks start_time,
     const ledger::Result result,
     const std::string& data) {
+  TRACE_EVENT2("browser", "BatLedgerClientMojoProxy::OnLoadPublisherList",
+               "size", data.size(),
+               "round_trip_ms",
+               (base::TimeTicks::Now() - start_time).InMillisecondsF());
   handler->OnPublisherListLoaded(result, data);
 }
 
@@ -246,7 +268,7 @@ void BatLedgerClientMojoProxy::LoadPublisherList(
 
   bat_ledger_client_->LoadPublisherList(
       base::BindOnce(&BatLedgerClientMojoProxy::OnLoadPublisherList,
-        AsWeakPtr(), base::Unretained(handler)));
+        AsWeakPtr(), base::Unretained(handler), base::TimeTicks::Now()));
 }
 
 void BatLedgerClientMojoProxy::OnSaveLedgerState(
@@ -257,6 +279,8 @@ void BatLedgerClientMojoProxy::OnSaveLedgerState(
 
 void BatLedgerClientMojoProxy::SaveLedgerState(
     const std::string& ledger_state, ledger::LedgerCallbackHandler* handler) {
+  TRACE_EVENT1("browser", "BatLedgerClientMojoProxy::SaveLedgerState",
+               "size", ledger_state.size());
   if (!Connected()) {
     handler->OnLedgerStateSaved(ledger::Result::LEDGER_ERROR);
     return;
@@ -276,6 +300,8 @@ void BatLedgerClientMojoProxy::OnSavePublisherState(
 void BatLedgerClientMojoProxy::SavePublisherState(
     const std::string& publisher_state,
     ledger::LedgerCallbackHandler* handler) {
+  TRACE_EVENT1("browser", "BatLedgerClientMojoProxy::SavePublisherState",
+               "size", publisher_state.size());
   if (!Connected()) {
     handler->OnPublisherStateSaved(ledger::Result::LEDGER_ERROR);
     return;
@@ -295,6 +321,8 @@ void BatLedgerClientMojoProxy::OnSavePublishersList(
 void BatLedgerClientMojoProxy::SavePublishersList(
     const std::string& publishers_list,
     ledger::LedgerCallbackHandler* handler) {
+  TRACE_EVENT1("browser", "BatLedgerClientMojoProxy::SavePublishersList",
+               "size", publishers_list.size());
   if (!Connected()) {
     handler->OnPublishersListSaved(ledger::Result::LEDGER_ERROR);
     return;
@@ -655,6 +683,8 @@ void BatLedgerClientMojoProxy::SaveState(
     const std::string& name,
     const std::string& value,
     ledger::OnSaveCallback callback) {
+  TRACE_EVENT1("browser", "BatLedgerClientMojoProxy::SaveState",
+               "size", value.size());
   if (!Connected()) {
     callback(ledger::Result::LEDGER_ERROR);
     return;
@@ -674,7 +704,8 @@ void BatLedgerClientMojoProxy::LoadState(
   }
 
   bat_ledger_client_->LoadState(
-      name, base::BindOnce(&OnLoadState, std::move(callback)));
+      name, base::BindOnce(&OnLoadState, std::move(callback),
+                           base::TimeTicks::Now()));
 }
 
 void BatLedgerClientMojoProxy::ResetState(
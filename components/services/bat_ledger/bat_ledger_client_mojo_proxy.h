@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 #include "chrome/browser/bitmap_fetcher/bitmap_fetcher_service.h"
@@ -190,10 +191,13 @@ class BatLedgerClientMojoProxy : public ledger::LedgerClient,
   mojom::BatLedgerClientAssociatedPtr bat_ledger_client_;
 
   void OnLoadLedgerState(ledger::OnLoadCallback callback,
+      base::TimeTicks start_time,
       const ledger::Result result, const std::string& data);
   void OnLoadPublisherState(ledger::OnLoadCallback callback,
+      base::TimeTicks start_time,
       const ledger::Result result, const std::string& data);
   void OnLoadPublisherList(ledger::LedgerCallbackHandler* handler,
+      base::TimeTicks start_time,
       const ledger::Result result, const std::string& data);
   void OnSaveLedgerState(ledger::LedgerCallbackHandler* handler,
       const ledger::Result result);
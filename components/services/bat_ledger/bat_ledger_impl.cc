@@ -142,7 +142,8 @@ void BatLedgerImpl::OnBackground(uint32_t tab_id, uint64_t current_time) {
 
 void BatLedgerImpl::OnPostData(const std::string& url,
     const std::string& first_party_url, const std::string& referrer,
-    const std::string& post_data, ledger::VisitDataPtr visit_data) {
+    const std::vector<std::string>& post_data,
+    ledger::VisitDataPtr visit_data) {
   ledger_->OnPostData(
       url, first_party_url, referrer, post_data, std::move(visit_data));
 }
@@ -441,10 +442,17 @@ void BatLedgerImpl::ConfirmAd(const std::string& info) {
 void BatLedgerImpl::OnGetTransactionHistory(
     CallbackHolder<GetTransactionHistoryCallback>* holder,
     std::unique_ptr<ledger::TransactionsInfo> history) {
-  std::string json_transactions = history.get() ? history->ToJson() : "";
+  auto info = mojom::TransactionsInfo::New();
+  if (history) {
+    info->estimated_pending_rewards = history->estimated_pending_rewards;
+    info->next_payment_date_in_seconds = history->next_payment_date_in_seconds;
+    info->ad_notifications_received_this_month =
+        history->ad_notifications_received_this_month;
+  }
+
   DCHECK(holder);
   if (holder->is_valid())
-    std::move(holder->get()).Run(json_transactions);
+    std::move(holder->get()).Run(std::move(info));
   delete holder;
 }
 
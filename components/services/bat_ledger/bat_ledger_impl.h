@@ -55,7 +55,8 @@ class BatLedgerImpl : public mojom::BatLedger,
 
   void OnPostData(const std::string& url,
       const std::string& first_party_url, const std::string& referrer,
-      const std::string& post_data, ledger::VisitDataPtr visit_data) override;
+      const std::vector<std::string>& post_data,
+      ledger::VisitDataPtr visit_data) override;
   void OnXHRLoad(uint32_t tab_id, const std::string& url,
       const base::flat_map<std::string, std::string>& parts,
       const std::string& first_party_url, const std::string& referrer,